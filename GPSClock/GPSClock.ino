@@ -1,5 +1,5 @@
 // Set version and date manually for code status display
-const char codeVersion[] = "v2.4.4   22.08.2025";
+const char codeVersion[] = "v2.5.0   17.10.2026";
 
 // or set date automatically to compilation date (US format) - nice to use during development - while version number is set manually
 // const char codeVersion[] = "v2.4.0   "__DATE__;
@@ -61,6 +61,102 @@ const char codeVersion[] = "v2.4.4   22.08.2025";
 
 /*
 Revisions:
+ 2.5.0   17.10.2026
+                - Cooperative task scheduler in clock_scheduler.h replaces fixed order of calls in loop():
+                  readGPS(), checkEncoder(), syncCheck(), GPSParse(), updateDisplay() are tasks with priority, period, deadline
+                -- Slow screens no longer hold up reading of GPS data and rotary encoder: Hebrew calendar, moon rise/set, lunar eclipses
+                   and planets call TaskYield()
+                -- Run-time statistics per task, on serial port with FEATURE_SERIAL_TASKS in clock_debug.h
+                - Setup menu (RotarySetup) is no longer blocking: state machine advanced from checkEncoder() on each pass of loop()
+                -- GPS data is read and time is synced while the menu is open
+                -- Time-out of menu and confirmation screens are timer events, StartTimer() in clock_scheduler.h
+                - Execution time statistics (min/avg/max + histogram) per task and per screen, FEATURE_PERF in clock_debug.h
+                -- New ScreenPerf for showing them, serial dump on request ('p'), see clock_perf.h
+                - Render ahead: screen for next second is drawn into an off-screen 20x4 buffer (clock_lcd_buffer.h) and 
+                  sent to the LCD right after the PPS pulse. The LCD driver object is now lcdHW, screens write to lcd as before
+                -- Time from PPS pulse to last byte on LCD in ppsToLcdMicros, and as stage "PPS->LCD" on ScreenPerf
+                -- One DrawScreen() per second: the frame rendered ahead is the one shown. Seconds drawn twice or not at all are counted with FEATURE_PERF
+                - The buffer is a shadow framebuffer: only cells which have changed are sent to the LCD, 
+                  as runs of one cursor move + characters. Sent after each task and before delay(). 
+                -- Average no of bytes to the LCD per second for each screen is shown on ScreenPerf
+                - No more lcd.clear() on the LCD itself: clear() only clears the framebuffer, so a change of screen 
+                  only sends the cells which differ. createChar() sets the cursor again, so loaders of custom 
+                  characters (loadArrowCharacters() etc) no longer need lcd.clear()
+                -- Change of screen (encoder, buttons, menu closed) draws the new screen in the same pass: cleared buffer is never sent
+                - Custom characters: LcdBuffer knows the bitmap in each of the 8 CGRAM slots and only loads missing ones.
+                -- Replaces LCDchar0_3, LCDchar4_5, LCDchar6_7, i.e. no more reloading of whole sets in demo mode
+                -- lcd.glyph(bitmap) gives slot of a bitmap, loads it into least recently used slot if needed. Only used for å in Reminder(),
+                   other custom characters are still in fixed slots
+                - LCD content as text on serial port, every second with FEATURE_SERIAL_FRAMES, or on request ('f') with FEATURE_PERF
+                - ScreenSelect() looks up the screen in table screens[] (PROGMEM) instead of a chain of 52 if/else if's
+                -- Each entry: function + argument, refresh (second/minute/day), custom character sets, needs GPS position, cost
+                -- Demo mode skips screens which need a GPS position as long as there is none
+                -- A repeated entry in menuStruct[] now gives the same screen twice, not "Invalid screen #"
+                - Refresh cadence per screen in screens[]: parts change every second, 10 seconds, minute or day
+                -- Screens are not called when none of their parts are due, e.g. MoonRiseSet(), EasterDates(), Equinoxes(), eclipses
+                -- RefreshDue() replaces the oldMinute checks in screens, InvalidateScreen() replaces lcd.clear(); oldMinute = -1;
+                -- Hebrew and Islamic dates in ISOHebIslam() are computed once a day instead of every minute/second
+                -- Minute changes follow the time being drawn, i.e. also with render ahead, not minuteGPS
+                - NMEA fields for GSV, GSA, RMC are extracted in one pass by NmeaEncode() in clock_nmea.h, replacing 
+                  26 TinyGPSCustom objects. Numbers go straight into sats[] and nmea.*, no atoi() in GPSParse(), GPSInfo()
+                -- Fix: Galileo was not counted in total no of satellites in view in GPSInfo(), BeiDou twice
+                - Satellites of GPS, GLONASS, Galileo, BeiDou in one table keyed by constellation + PRN (clock_satellites.h), 
+                  was GPS only. GSV cycles are assembled per constellation, satellites not in a complete cycle are removed,
+                  constellations without GSV for 10 s are removed. No of tracked satellites and SNR sum per constellation
+                  are kept up to date with each change, and shown in GPSInfo() as tracked/in view and average SNR
+                - Health of serial link from GPS in clock_gpslink.h, new ScreenGPSLink: bytes/s, sentences/s per type, 
+                  RX buffer high-water mark, checksum errors, sentences cut off, gaps in data from GPS
+                -- Longest time between calls of readGPS() is compared with time to fill the RX buffer at the GPS baud rate,
+                   if longer, the screen shown then is flagged as the one causing loss of data
+                -- ScreenDemoClock is now 53, noOfScreens 54
+                - Replay of recorded NMEA data from PROGMEM instead of GPS, FEATURE_NMEA_REPLAY in clock_debug.h, see clock_replay.h
+                -- One epoch per second, N times faster or as fast as possible (REPLAY_SPEED), PPS via ppsHandler() before each epoch
+                -- Snapshot of utc, localTime and LCD content on serial port per epoch, bytes and time per pass of the log
+                -- Synthetic log: start of DST in Europe, GPS + GLONASS + Galileo + BeiDou, loss of fix
+                - u-blox UBX binary protocol as alternative to NMEA (clock_ubx.h): NAV-PVT, NAV-SAT, TIM-TP, 
+                  fields from fixed offsets, no text parsing. New item "b. GPS protocol" in secondary menu, EEPROM_OFFSET1 + 13
+                -- GPS data is read through gnss.* (same names as TinyGPS++: gnss.location.lat() etc), from gps or ubx
+                -- NAV-SAT fills sats[] and nmea.inView[], NAV-PVT fills nmea.gnssMode/gnssStatus, so GPSInfo() is unchanged
+                -- Secondary menu items b. - g. are now c. - h.
+                - Receiver is configured at start-up to send only what is needed (clock_gpsconfig.h), PMTK314 for MediaTek 
+                  (QLG1, QLG2), UBX-CFG-MSG for u-blox: GPS_CONFIG_MTK or GPS_CONFIG_UBLOX in clock_hardware.h, off by default
+                -- RMC + GGA, and GSA + GSV only if ScreenGPSInfo is in the chosen subset of screens. 
+                   GSV every 5th second, every second while GPSInfo() is shown. Re-sent when this changes
+                - Automatic baud rate (clock_autobaud.h): after 5 s without valid checksums, all rates are tried in the background, 
+                  the one with most valid sentences is used and saved in EEPROM
+                -- Baud rates up to 115200 in gpsBaud1[]. A change in the secondary menu is also sent to the receiver (PMTK251, UBX-CFG-PRT)
+                -- Fix: check of baudRateNumber from EEPROM allowed one beyond the end of gpsBaud1[]
+                - Position snapshot (clock_position.h): latitude, lon, alt are set by PositionGet() instead of in each screen.
+                  position.version only changes for moves > 100 m or a new fix quality, so results can be kept until then
+                -- Locator in LcdUTCTimeLocator() is only computed for a new position
+                -- Sidereal() and UpdateMoonPosition() also use the snapshot, and DEBUG_MANUAL_POSITION is handled in one place
+                - PPS timing (clock_pps.h): interval between PPS pulses with micros() gives frequency error (ppm) and jitter of 
+                  the MCU clock, and lag from pulse to setTime(). nowMicros() = us into the UTC second of now()
+                -- New ScreenPPS shows them, ScreenDemoClock is now 54, noOfScreens 55
+                -- FEATURE_SERIAL_PPS in clock_debug.h prints them for each pulse
+                - Holdover (clock_holdover.h): when time from GPS or PPS is lost, seconds are counted with micros() corrected 
+                  by the frequency error and drift learned from PPS, instead of TimeLib on the uncorrected MCU clock
+                -- syncTimeGPS() no longer sets the last, old time from GPS again and again when the data stops
+                -- New ScreenHoldover: time since last sync, estimated error, error measured when PPS came back, correction
+                -- ScreenDemoClock is now 55, noOfScreens 56. gnss.time.age() as in TinyGPS++
+                -- syncLocalTime() split out of syncTimeGPS()
+                - Time zones: TzLocal() in clock_tzcache.h replaces copies of Timezone objects and toLocal() 
+                -- Offset and daylight saving rule are kept until the next change, also for the zones of TimeZones()
+                -- clock_timezone.h: table timeZoneRules[] of rule pairs instead of Timezone objects, saves RAM
+                -- TimeZones() uses userTimeZones[] of clock_options.h, as intended, instead of fixed numbers 
+                - clock_timezone.h: all zones in one table timeZones[] in flash with a name for the setup menu, 23 more zones (43)
+                -- NUMBER_OF_TIME_ZONES follows the table. Setup menu shows no and name of zone instead of a letter
+                - World clock (clock_worldclock.h): TimeZones() pages through up to 16 zones, 4 at a time, every 10 s
+                -- List set in new secondary menu item "i. World clock", EEPROM_OFFSET1 + 14 ... 30. userTimeZones[] for cold start
+                -- Local hour, minute of each zone advanced every minute, rules only read again at daylight saving changes
+                - moment.* (clock_moment.h): UTC and local time broken down once per frame by DrawScreen(), read by all screens 
+                  instead of hour(now()), minute(localTime), ..., i.e. no more breakTime() each time they alternate
+                -- Also Julian Day (jd, jd_frac as get_julian_date()), day of year and ISO week, the last two once a day
+                -- FEATURE_DATE_PER_SECOND steps local time in MomentFill() for all screens
+                - solar[] (clock_solar.h): sun rise, set, twilight and noon computed once per day and position, not for each line of sun screens
+                -- tomorrow computed before UTC midnight by SolarTask, current azimuth, elevation once per second
+                -- Azimuth at rise and set (W) now at the exact times
+
  2.4.4   21.08.2025
                 - Check if there is a need for correction of QRPLabs QLG2 GPS Module which has a 1024 week rollover problem
                 ---  All occurences of yearGPS, monthGPS, dayGPS replaced by year(), month(), day() in GPSClock.ino; clock_helper.h, clock_z_equatio.h
@@ -334,6 +430,9 @@ One routine per clock face, i.e. one per menu item:
             SolarEclipse
             NextEvents
             Progress
+            GPSLink
+            PPS
+            Holdover
 
 */
 
@@ -353,11 +452,10 @@ One routine per clock face, i.e. one per menu item:
 #define ALL_ON 255   // in LCD character set
 #define DOT 165      // dot for date deliminator, Morse code, and for big letter clock
 
-#define EEPROM_OFFSET1 0    // first address for setup info in EEPROM, adresses used: EEPROM_OFFSET1 ... EEPROM_OFFSET1 + 12
+#define EEPROM_OFFSET1 0    // first address for setup info in EEPROM, adresses used: EEPROM_OFFSET1 ... EEPROM_OFFSET1 + 30
 #define EEPROM_OFFSET2 100  // first address for birthday info for Reminder()
 
-#define noOfScreens 52  // must be large enough to hold all possible screens in menu!!
-#define NUMBER_OF_TIME_ZONES 20  // no of time zones defined in clock_timezone.h
+#define noOfScreens 56  // must be large enough to hold all possible screens in menu!!
 
 #define RAD (PI / 180.0)
 
@@ -368,6 +466,7 @@ char textBuffer[21];  // 1 line on lcd, 20 characters; For display of strings
 
 const int lengthOfMenuIn = noOfScreens;
 byte menuOrder[noOfScreens];  // chosen submenu is here, from int --> byte
+byte menuScreen[noOfScreens]; // inverse of menuOrder[]: screen number for each position in menu, new 17.10.2026
 int noOfStates = 0;           // no of actual entries in chosen submenu_name
 
 long utcOffset = 0;  // unit: minutes, value set automatically by means of Timezone library
@@ -378,6 +477,16 @@ struct Menu_type
   int8_t order[noOfScreens]; 
 };
 
+typedef struct    // properties of a screen, see screens[] and clock_defines.h, new 17.10.2026
+{
+  void (*function)(byte);  // NULL = screen not compiled
+  byte arg;
+  byte refresh;   // REFRESH_...
+  byte glyphs;    // GLYPHS_...
+  byte flags;     // SCREEN_...
+  byte cost;      // COST_...
+} screen_type;
+
 struct Date_Time
 {
   char descr[10];
@@ -400,7 +509,7 @@ struct Date_Time
 // See project wiki for source for alle the libraries
 
 #include <TimeLib.h>           // https://github.com/PaulStoffregen/Time - timekeeping functionality
-#include <Timezone_Generic.h>  // https://github.com/khoih-prog/Timezone_Generic
+#include <Timezone_Generic.h>  // https://github.com/khoih-prog/Timezone_Generic - TimeChangeRule, 17.10.2026: toLocal() in clock_tzcache.h
 #include <SolarCalculator.h>   // https://www.arduino.cc/reference/en/libraries/solarcalculator/ 19.02.2024
 
 
@@ -408,9 +517,8 @@ struct Date_Time
 
 #include "clock_z_calendar.h"
 
-Timezone tz;  // holds currently selected timezone
-
 #include "clock_timezone.h"  // timezone definitions, including daylight saving rules
+#include "clock_tzcache.h"   // 17.10.2026: local time with cached daylight saving changes, replaces Timezone tz
 
 #if defined(FEATURE_LCD_I2C)
   #include <Wire.h>               // For I2C. Comes with Arduino IDE
@@ -434,32 +542,23 @@ Timezone tz;  // holds currently selected timezone
 //            set the LCD address to 0x27 and set the pins on the I2C chip used for LCD connections:
 //                     addr, en,rw,rs,d4,d5,d6,d7,bl,blpol
   #ifdef OLD_LCD_LIBRARY
-    LiquidCrystal_I2C lcd(0x27, 2, 1, 0, 4, 5, 6, 7, 3, POSITIVE);  // Set the LCD I2C address
+    LiquidCrystal_I2C lcdHW(0x27, 2, 1, 0, 4, 5, 6, 7, 3, POSITIVE);  // Set the LCD I2C address
   #else
-    hd44780_I2Cexp lcd;               // declare lcd object: auto locate & auto config expander chip
+    hd44780_I2Cexp lcdHW;             // declare lcd object: auto locate & auto config expander chip
   #endif
 #endif
 
 #if defined(FEATURE_LCD_4BIT)
-  LiquidCrystal lcd(lcd_rs, lcd_enable, lcd_d4, lcd_d5, lcd_d6, lcd_d7);
+  LiquidCrystal lcdHW(lcd_rs, lcd_enable, lcd_d4, lcd_d5, lcd_d6, lcd_d7);
 #endif
 
 #define NCOLS 20  // LCD
 #define NROWS 4   // LCD
 
-Rotary r = Rotary(PIN_A, PIN_B, PUSHB);  // Initialize the Rotary object
+#include "clock_lcd_buffer.h"  // 17.10.2026: screens write to lcd, an off-screen buffer in front of lcdHW
+LcdBuffer lcd;
 
-byte LCDchar0_3 = 0; // 0 means unknown status
-byte LCDchar4_5 = 0;
-byte LCDchar6_7 = 0;
-#define LCDARROWS  1 // for LCDchar0_3
-#define LCDNATIVE  2 // for LCDchar4_5, LCDchar6_7
-#define LCD3WIDE   3 // for LCDchar0_3, LCDchar4_5, LCDchar6_7
-#define LCD3HIGH   4 // for LCDchar0_3, LCDchar4_5, LCDchar6_7
-#define LCDGAPLESS 5 // for LCDchar0_3, LCDchar4_5 
-#define LCDBARS    6 // for LCDchar4_5
-#define LCDARING   7 // for LCDchar6_7
-#define LCDFRAMEDBARS 8 
+Rotary r = Rotary(PIN_A, PIN_B, PUSHB);  // Initialize the Rotary object
 
 byte buffer[8];  // temporary storage for PROGMEM characters before writing to LCD
 
@@ -480,6 +579,8 @@ uint32_t noSats; //was u32
 TimeChangeRule *tcr;  //pointer to the time change rule (tcr), use to get TZ abbrev
 time_t utc, localTime;
 time_t prevDisplay = 0;  // keeps time from now(), to find out last time when the digital clock was displayed
+time_t frameTime = 0;    // second for which the screen has been rendered ahead into lcd buffer, 0 = none. 17.10.2026
+int frameDispState;      // screen which was rendered ahead
 
 int packedRise;
 double moon_azimuth = 0;
@@ -487,11 +588,16 @@ double moon_elevation = 0;
 double moon_dist = 0;
 
 int iiii;            // general loop counter
-int oldMinute = -1;  // compared to minuteGPS in order to get immediate display of some info
+byte refreshDue = REFRESH_ALL;  // parts of screen which are due in this update, see DrawScreen() and RefreshDue(). 17.10.2026: replaces oldMinute
+bool screenInvalid = true;       // set by InvalidateScreen(): next update draws everything
+time_t lastDrawTime = 0;         // now() of last screen update
 
 int yearGPS;
 uint8_t monthGPS, dayGPS, hourGPS, minuteGPS, secondGPS, weekdayGPS;
 volatile byte pps = 0;  // GPS one-pulse-per-second flag
+volatile uint32_t ppsMicros = 0;  // micros() at last PPS pulse
+uint32_t ppsToLcdMicros = 0;      // time from PPS pulse until last byte of new second has been sent to LCD, 17.10.2026
+uint32_t maxPpsToLcdMicros = 0;
 
 /*
   Uses Serial1 for GPS input
@@ -519,9 +625,9 @@ int8_t mathSecondPeriod = COLDSTART_mathSecondPeriod; // 10-60 seconds (i.e. 1..
 boolean using_PPS = COLDSTART_using_PPS;     			// toggle use of PPS pulse from GPS for interrupt and more accurate timeing
 int8_t demoStepType = COLDSTART_demoStepType;       	// step type in demo (increase +, decrease -, random)
 int8_t firstDayWeek     = COLDSTART_firstDayWeek;   	// 1 for Sunday, 2 for Monday, ... 
+byte gpsProtocol = COLDSTART_gpsProtocol;             // PROTOCOL_NMEA or PROTOCOL_UBX, new 17.10.2026
 int8_t Twelve24Local    = COLDSTART_Twelve24Local;  	// 24 or 12 for hrs for local time
 
-int8_t presentLanguageNumber = COLDSTART_languageNumber; // remembering the present language for detecting need for change
 char demoStepTypeText[][7] = {"+", "-", "random"};     // hard-coded index range 0..2 for demoStepType here and there in code
 
 #ifdef STEP_FASTER
@@ -553,37 +659,19 @@ char demoStepTypeText[][7] = {"+", "-", "random"};     // hard-coded index range
   12-15= Information about third SV, same as field 4-7
   16-19= Information about fourth SV, same as field 4-7
 */
-static const int MAX_SATELLITES = 40;
-
-TinyGPSCustom totalGPGSVMessages(gps, "GPGSV", 1);  // $GPGSV sentence, first element
-TinyGPSCustom messageNumber(gps, "GPGSV", 2);       // $GPGSV sentence, second element
-TinyGPSCustom GPsatsInView(gps, "GPGSV", 3);        // $GPGSV sentence, third element
-TinyGPSCustom GPSMode(gps, "GPGSA", 2);             // $GPGSA sentence, 2nd element 1-none, 2=2D, 3=3D
-TinyGPSCustom GPSposStatus(gps, "GPRMC", 2);           // $GPRMC sentence: Position status (A = data valid, V = data invalid)
-TinyGPSCustom satNumber[4];                         // to be initialized later
-TinyGPSCustom elevation[4];
-TinyGPSCustom azimuth[4];
-TinyGPSCustom snr[4];
-
-
-#ifndef GPSONLY // new 2.4.2025:
-TinyGPSCustom GLsatsInView(gps, "GLGSV", 3); // Glonass
-TinyGPSCustom GBsatsInView(gps, "GBGSV", 3); // BeiDou
-TinyGPSCustom GAsatsInView(gps, "GAGSV", 3); // Galileo
-TinyGPSCustom GNSSMode(gps, "GNGSA", 2);
-TinyGPSCustom GNSSposStatus(gps, "GNRMC", 2);
-#endif
-
-struct
-{
-  bool active;
-  int elevation;
-  int azimuth;
-  int snr;
-} sats[MAX_SATELLITES];
-
-float SNRAvg = 0.0;
-int totalSats = 0;
+float SNRAvg = 0.0;  // of tracked satellites, all constellations
+int totalSats = 0;   // tracked satellites, SNR > 0
+
+#include "clock_gpslink.h"     // 17.10.2026: bytes, sentences, RX buffer, errors of serial link from GPS
+#include "clock_nmea.h"        // 17.10.2026: GSV, GSA, RMC fields -> sats[], nmea.*, replaces TinyGPSCustom objects
+#include "clock_satellites.h"  // 17.10.2026: satellites of all constellations, statistics per constellation
+#include "clock_ubx.h"         // 17.10.2026: u-blox binary protocol, gnss.* = GPS data from either protocol
+#include "clock_gpsconfig.h"   // 17.10.2026: receiver only sends the messages which are needed
+#include "clock_autobaud.h"    // 17.10.2026: finds baud rate of receiver when there is no valid data
+#include "clock_position.h"    // 17.10.2026: position snapshot with version, changes only for moves > POSITION_MOVE
+#include "clock_pps.h"         // 17.10.2026: frequency error and jitter of MCU clock from PPS, nowMicros()
+#include "clock_holdover.h"    // 17.10.2026: time kept with learned frequency error when GPS is lost
+#include "clock_worldclock.h"  // 17.10.2026: zones of TimeZones(), list in EEPROM, local time kept per zone
 
 #ifdef FEATURE_DATE_PER_SECOND  // for stepping date quickly and check calender function
   int dateIteration;
@@ -593,8 +681,17 @@ int totalSats = 0;
 byte cursorFactor;
 byte lineFactor;
 
+#include "clock_moment.h"           // 17.10.2026: time of the frame being drawn, broken down once for all screens
+#include "clock_solar.h"            // 17.10.2026: sun rise, set, twilight and noon computed once per day
 #include "clock_language.h"         // user customable functions and character sets for multiple local languages, was "clock_custom_routines.h"
+#include "clock_scheduler.h"        // cooperative scheduler for the tasks in loop()
+#ifdef FEATURE_PERF
+  #include "clock_perf.h"           // execution time statistics per task and screen
+#endif
 #include "clock_helper_routines.h"  // library of functions
+#ifdef FEATURE_NMEA_REPLAY
+  #include "clock_replay.h"         // recorded NMEA data instead of GPS, for tests and benchmarks
+#endif
 
 #include "clock_z_moon_eclipse.h"
 #include "clock_z_equatio.h"
@@ -606,21 +703,39 @@ byte lineFactor;
 //////////////////////////////////////////////////////////////////////////////////////////////
 void readGPS() {
   // ******** start gps time update
+  #ifdef FEATURE_NMEA_REPLAY                      // 17.10.2026: recorded NMEA data from PROGMEM, clock_replay.h
+    LinkRead(0);
+    ReplayEpoch();
+    return;
+  #endif
   #ifndef FEATURE_FAKE_SERIAL_GPS_IN
+    LinkRead(Serial1.available());                // 17.10.2026: RX buffer fill, time since last call, clock_gpslink.h
     while (Serial1.available()) {
-      if (gps.encode(Serial1.read())) {           // process gps messages from hw GPS (default mode)
+      char c = Serial1.read();                    // process gps messages from hw GPS (default mode)
 
   #else  // normal mode:
+    LinkRead(Serial.available());
     while (Serial.available()) {
-      if (gps.encode(Serial.read())) {            // process gps messages from sw GPS emulator
+      char c = Serial.read();                     // process gps messages from sw GPS emulator
   #endif 
-      }  // (gps.encode(Serial.read()))
+      LinkByte(c);                                // bytes/s, cut sentences, clock_gpslink.h
+      if (gpsProtocol == PROTOCOL_UBX)
+        UbxEncode(c);                             // NAV-PVT, NAV-SAT, TIM-TP, clock_ubx.h
+      else {
+        NmeaEncode(c);                            // GSV, GSA, RMC fields, clock_nmea.h
+        gps.encode(c);                            // time, date, position, hdop
+      }
     }    // while (Serial.available())
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////
 
 void syncCheck() {                         // from GPS_Clock_triple.ino by Bruce E. Hall, w8bh.net
+  if (pps) PpsPulse();                     // 17.10.2026: interval since last pulse, clock_pps.h
+  if (HoldoverCheck()) {                   // 17.10.2026: GPS lost, time is kept by clock_holdover.h
+    pps = 0;
+    return;
+  }
   if (pps || (!using_PPS)) syncTimeGPS();  // is it time to sync with GPS?
   pps = 0;                                 // reset flag, regardless
 }
@@ -628,6 +743,7 @@ void syncCheck() {                         // from GPS_Clock_triple.ino by Bruce
 //                                                    from GPS_Clock_triple.ino by Bruce E. Hall, w8bh.net
 void ppsHandler() {  // 1pps interrupt handler:
   pps = 1;           // flag that signal was received
+  ppsMicros = micros();
   #ifdef FEATURE_INTERRUPTTEST
     state = !state; // for Built in LED
   #endif
@@ -636,15 +752,15 @@ void ppsHandler() {  // 1pps interrupt handler:
 
 void syncTimeGPS() {
   //if (gps.time.isValid())     // 29.08.2023 as gps.time.* was sometimes way off (due to corrupt GPS data?)
-  if (gps.time.isValid()) // && gps.location.age() < 500)  // age in millisecs: too strict. W8BH uses "<= 1000"
+  if (gnss.time.isValid()) // && gps.location.age() < 500)  // age in millisecs: too strict. W8BH uses "<= 1000"
   {
     // when GPS reports new data...
-    hourGPS   = gps.time.hour();
-    minuteGPS = gps.time.minute();
-    secondGPS = gps.time.second();
-    dayGPS    = gps.date.day();
-    monthGPS  = gps.date.month();
-    yearGPS   = gps.date.year();
+    hourGPS   = gnss.time.hour();
+    minuteGPS = gnss.time.minute();
+    secondGPS = gnss.time.second();
+    dayGPS    = gnss.date.day();
+    monthGPS  = gnss.date.month();
+    yearGPS   = gnss.date.year();
                              
     // set the Time to the latest GPS reading
     setTime(hourGPS, minuteGPS, secondGPS, dayGPS, monthGPS, yearGPS);  // Versions from 17.04.2020+: Arduino time = UTC
@@ -655,19 +771,9 @@ void syncTimeGPS() {
 
     weekdayGPS = weekday();
     if (using_PPS) adjustTime(1);  // if using interrupt adjust forward 1 second (only integer seconds)
+    PpsSync();                     // 17.10.2026: start of this second for nowMicros(), lag after PPS, clock_pps.h
 
-    utc = now();  // updated even if GPS data stream stops in order to avoid frozen UTC display
-                  //if (using_PPS) utc = utc + 1; // if using interrupt adjust forward 1 second
-                  //if (!using_PPS) delay(500); // without pps, clock is x00 ms too late (Arduino Mega), but this makes it irregular ...
-
-    tz = *timeZones_arr[timeZoneNumber];  //
-    localTime = tz.toLocal(utc, &tcr);
-
-#ifdef AUTO_UTC_OFFSET                                    // the usual mode
-    utcOffset = localTime / long(60) - now() / long(60);  // min, order of calculation is important
-#else
-    localTime = now() + utcOffset * 60;                   // utcOffset in minutes is set manually in clock_options.h (was in clock_zone.h)
-#endif
+    syncLocalTime();
   }  // gps.time.isValid
 
 #ifdef FEATURE_SERIAL_TIME
@@ -682,68 +788,210 @@ void syncTimeGPS() {
 #endif
 }  // ******** end syncTimeGPS()
 
+////////////////////////////////////////////////////////////////////////////////
+void syncLocalTime() {  // utc, local time and offset after setTime(), from syncTimeGPS() and holdover. 17.10.2026: was in syncTimeGPS()
+    utc = now();  // updated even if GPS data stream stops in order to avoid frozen UTC display
+                  //if (using_PPS) utc = utc + 1; // if using interrupt adjust forward 1 second
+                  //if (!using_PPS) delay(500); // without pps, clock is x00 ms too late (Arduino Mega), but this makes it irregular ...
+
+    localTime = TzLocal(timeZoneNumber, utc, &tcr);  // 17.10.2026: was tz = *timeZones_arr[timeZoneNumber]; tz.toLocal(utc, &tcr)
+
+#ifdef AUTO_UTC_OFFSET                                    // the usual mode
+    utcOffset = localTime / long(60) - now() / long(60);  // min, order of calculation is important
+#else
+    localTime = now() + utcOffset * 60;                   // utcOffset in minutes is set manually in clock_options.h (was in clock_zone.h)
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ShowFrame(int disp) {  // lcd buffer -> LCD, statistics for screen at menu position disp. 17.10.2026
+#if defined(FEATURE_PERF) || defined(FEATURE_SERIAL_FRAMES)
+  uint16_t sent = lcd.show();  // only the cells which differ from present LCD content
+#else
+  lcd.show();
+#endif
+#ifdef FEATURE_PERF
+  PerfLcdBytes(disp, sent);
+#endif
+#ifdef FEATURE_SERIAL_FRAMES
+  PrintFrame(disp, sent);
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 void updateDisplay() {
+  if (menuState != MENU_OFF) {  // setup menu has the display, 17.10.2026
+    if (frameTime != 0) {       // forget screen rendered ahead, menu writes are sent after each task
+      frameTime = 0;
+      lcd.release();
+    }
+    return;
+  }
   if (timeStatus() != timeNotSet) {
-    if (now() != prevDisplay) {  //update the display only if the time has changed. i.e. every second
-      prevDisplay = now();
+    // 17.10.2026: render ahead. The screen for the next second is drawn into the lcd buffer in the idle part of this second,
+    // and sent to the LCD as soon as the second rolls over, i.e. right after the PPS pulse has set the time in syncCheck().
+    // prevDisplay is the second shown on the LCD, frameTime the one waiting in the buffer: one DrawScreen() per second
+    if (frameTime != 0 && (now() + 1 != frameTime || dispState != frameDispState)) {
+      if (now() == frameTime && dispState == frameDispState) {  // the second it was drawn for
+        ShowFrame(frameDispState);
+        prevDisplay = frameTime;
+        frameTime = 0;
+        if (using_PPS) {
+          uint32_t latency = micros() - ppsMicros;
+          if (latency < 1000000UL) {  // from this PPS pulse
+            ppsToLcdMicros = latency;
+            if (latency > maxPpsToLcdMicros) maxPpsToLcdMicros = latency;
+#ifdef FEATURE_PERF
+            PerfAdd(PERF_PPS_LCD, latency);
+#endif
+          }
+        }
+        return;             // next second is rendered in a later pass, after the other tasks
+      }
+      frameTime = 0;        // time has jumped, or new screen: not shown, drawn again for now() below
+      lcd.release();
+      InvalidateScreen();
+      prevDisplay = 0;
+    }
+
+    if (now() != prevDisplay) {  // update the display only if the time has changed. i.e. every second
+      prevDisplay = now();       // not rendered ahead, e.g. at start or after change of screen
+      DrawScreen();
+      ShowFrame(dispState);
+    }
+    else if (frameTime == 0) {   // render next second into buffer, LCD still shows this second
+      adjustTime(1);
+      utc++;
+      localTime++;
+      frameTime = now();
+      frameDispState = dispState;
+      lcd.hold();     // LCD is not changed before ShowFrame() above
+      DrawScreen();
+      adjustTime(-1);
+      utc--;
+      localTime--;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ScreenChanged() {  // new dispState, or menu closed: draw it in this pass, the cleared buffer is never shown. 17.10.2026
+  frameTime = 0;        // screen rendered ahead, if any, is for the old dispState
+  lcd.release();
+  prevDisplay = 0;
+  updateDisplay();      // shows the changed cells, e.g. no blank LCD until the next second
+}
+
+#ifdef FEATURE_SERIAL_FRAMES
+////////////////////////////////////////////////////////////////////////////////
+void PrintFrame(int disp, uint16_t sent) {  // new 17.10.2026: LCD content as text, with UTC and menu position
+  Serial.print(F("frame ")); Serial.print(now());
+  Serial.print(F(" ")); PrintFixedWidth(Serial, hour(now()), 2, '0');
+  Serial.print(F(":")); PrintFixedWidth(Serial, minute(now()), 2, '0');
+  Serial.print(F(":")); PrintFixedWidth(Serial, second(now()), 2, '0');
+  Serial.print(F(" UTC, menu ")); Serial.print(disp);
+  Serial.print(F(", ")); Serial.print(sent); Serial.println(F(" bytes to LCD"));
+  lcd.printFrame(Serial);
+}
+#endif
+
+/*****
+Purpose: 
+Refresh cadence of screens, 17.10.2026. Replaces oldMinute, which each screen compared to minuteGPS.
+screens[] tells which parts of each screen change every second, 10 seconds, minute or day (REFRESH_...). 
+DrawScreen() finds which of them are due for now(), and ScreenSelect() doesn't call a screen at all when 
+none of its parts are due: the LCD buffer keeps what it showed. Inside a screen, RefreshDue() tells 
+whether a part has to be drawn. 
+After InvalidateScreen() (new screen, menu closed) all parts are due, and RefreshDue(REFRESH_FIRST) is true.
+*****/
+
+void InvalidateScreen() {  // was lcd.clear(); oldMinute = -1;
+  lcd.clear();
+  screenInvalid = true;
+}
+
+bool RefreshDue(byte refresh) {  // one of the parts in refresh (REFRESH_... bits) is due in this update
+  return (refreshDue & refresh) != 0;
+}
+
+void FindRefreshDue() {  // parts due for now(), since last update
+  time_t timeNow = now();
+  refreshDue = REFRESH_SECOND;
+  if (timeNow / 10 != lastDrawTime / 10) refreshDue |= REFRESH_10S;
+  if (timeNow / 60 != lastDrawTime / 60) refreshDue |= REFRESH_MINUTE;
+  if ((timeNow + utcOffset * 60) / SECS_PER_DAY != (lastDrawTime + utcOffset * 60) / SECS_PER_DAY) refreshDue |= REFRESH_DAY;
+  if (screenInvalid) refreshDue = REFRESH_ALL;
+  screenInvalid = false;
+  lastDrawTime = timeNow;
+}
 
-      if (demoDispState == menuOrder[ScreenISOHebIslam])                // new 09.10.2024
+////////////////////////////////////////////////////////////////////////////////
+void DrawScreen() {  // draw screen for second now(), was part of updateDisplay()
+#ifdef FEATURE_PERF
+  if (!screenInvalid && now() == lastDrawTime)    perfDrawRepeats++;  // same second drawn twice, render ahead doesn't work
+  if (!screenInvalid && now() > lastDrawTime + 1) perfDrawSkips++;    // a second not drawn, e.g. a slow screen or time jump
+#endif
+  if (demoDispState == menuOrder[ScreenISOHebIslam])                // new 09.10.2024
 	    // int(elapsedTime/1000.): Arduino Mega a bit slow. With int(round(elapsedTime/1000.)): a bit too fast
-        demoDuration = min(demoDuration + 1 + int(elapsedTime/1000.0), 10000); // limit it in order not to overflow
-      else
-        demoDuration = min(demoDuration + 1, 10000);                 // limit it in order not to overflow
+    demoDuration = min(demoDuration + 1 + int(elapsedTime/1000.0), 10000); // limit it in order not to overflow
+  else
+    demoDuration = min(demoDuration + 1, 10000);                 // limit it in order not to overflow
 
-      // this is for jumping from screen to screen in demo Mode:
-      if ((dispState == menuOrder[ScreenDemoClock]) && (demoDuration >= dwellTimeDemo))  // demo mode: increment screen number, new 30.8.2023
-      {
-        if (demoStepType == 1)
-          demoDispState -= 1;                       // decrement screen number in demo mode                              
-        else if (demoStepType == 2)         
-        {
-          do  {                                         // 09.10.2024: check to avoid same draw
-              demoDispState = random(0, noOfStates-1);  // random choice of screen number in demo mode (noOfStates-1 in order not to recursively select demo Mode itself)
-              } while (demoDispState == previousDemoDispState);
-          previousDemoDispState = demoDispState;  //save the currently chosen demoDispState so we don't repeat it
-        }
-        else
-          demoDispState += 1;                     // increment screen number in demo mode
+  // this is for jumping from screen to screen in demo Mode:
+  if ((dispState == menuOrder[ScreenDemoClock]) && (demoDuration >= dwellTimeDemo))  // demo mode: increment screen number, new 30.8.2023
+  {
+    if (demoStepType == 1)
+      demoDispState -= 1;                       // decrement screen number in demo mode                              
+    else if (demoStepType == 2)         
+    {
+      do  {                                         // 09.10.2024: check to avoid same draw
+          demoDispState = random(0, noOfStates-1);  // random choice of screen number in demo mode (noOfStates-1 in order not to recursively select demo Mode itself)
+          } while (demoDispState == previousDemoDispState);
+      previousDemoDispState = demoDispState;  //save the currently chosen demoDispState so we don't repeat it
+    }
+    else
+      demoDispState += 1;                     // increment screen number in demo mode
+
+    if (demoDispState < 0) demoDispState += noOfStates;  // but not below the lowest number
+    demoDispState = demoDispState % noOfStates;          // or above the largest number
 
-        if (demoDispState < 0) demoDispState += noOfStates;  // but not below the lowest number
-        demoDispState = demoDispState % noOfStates;          // or above the largest number
+    // 17.10.2026: skip screens which need a position as long as GPS has none, see screens[]
+    for (int k = 0; k < noOfStates && !gnss.location.isValid() && ScreenNeedsFix(demoDispState); k++)
+    {
+      if (demoStepType == 1) demoDispState = (demoDispState + noOfStates - 1) % noOfStates;
+      else                   demoDispState = (demoDispState + 1) % noOfStates;
+    }
 #ifdef FEATURE_SERIAL_MENU
-        Serial.print(F("demoDispState "));
-        Serial.println(demoDispState);
-        Serial.print(F("dispState "));
-        Serial.print(dispState);
-        Serial.print(", ");
-        Serial.print(menuOrder[ScreenDemoClock]);
-        Serial.print(F(", oldMinute "));
-        Serial.println(oldMinute);
-        //            Serial.print(F("now() ")); Serial.println(now());
-        //            Serial.print(minute(now())); Serial.print(":");Serial.println(second(now()));
-        //Serial.print(F("demoDuration "));
-        //Serial.println(demoDuration);
-        Serial.println(" ");
+    Serial.print(F("demoDispState "));
+    Serial.println(demoDispState);
+    Serial.print(F("dispState "));
+    Serial.print(dispState);
+    Serial.print(", ");
+    Serial.print(menuOrder[ScreenDemoClock]);
+    Serial.print(F(", refreshDue "));
+    Serial.println(refreshDue, HEX);
+    //            Serial.print(F("now() ")); Serial.println(now());
+    //            Serial.print(minute(now())); Serial.print(":");Serial.println(second(now()));
+    //Serial.print(F("demoDuration "));
+    //Serial.println(demoDuration);
+    Serial.println(" ");
 #endif
-        demoDuration = 0;  // reset counter of seconds between demo screen
-        lcd.clear();       // clear if demo just started ? - no, happens every time
-        oldMinute = -1;    // to get immediate display of some info. Moved here 27.6.2023
-      }
+    demoDuration = 0;    // reset counter of seconds between demo screen
+    InvalidateScreen();  // to get immediate display of some info. Moved here 27.6.2023
+  }
 
-      ////////////////////////////////////////// USER INTERFACE /////////////////////////////////////////////////////////
+  ////////////////////////////////////////// USER INTERFACE /////////////////////////////////////////////////////////
 #ifdef FEATURE_SERIAL_MENU
-      //Serial.print(F("dispState ")); Serial.println(dispState);
-      //Serial.println((dispState % noOfStates));
-      //Serial.println(menuOrder[dispState % noOfStates]);
+  //Serial.print(F("dispState ")); Serial.println(dispState);
+  //Serial.println((dispState % noOfStates));
+  //Serial.println(menuOrder[dispState % noOfStates]);
 #endif
 
-      ////////////// This is the order of the menu system unless menuOrder[] contains information to the contrary
+  ////////////// This is the order of the menu system unless menuOrder[] contains information to the contrary
 
-      ScreenSelect(dispState, 0);  // select right routine for chosen screen, 0 = ordinary, i.e. not demo mode
-
-    }  // if (now() != prevDisplay)
-  }    // if (timeStatus() != timeNotSet)
+  MomentFill();  // 17.10.2026: time broken down once for the screen, clock_moment.h
+  FindRefreshDue();
+  ScreenSelect(dispState, 0);  // select right routine for chosen screen, 0 = ordinary, i.e. not demo mode
 }
 
 
@@ -752,33 +1000,47 @@ void updateDisplay() {
 void checkEncoder()  // check and read rotation and button of rotary encoder
 {
   volatile unsigned char rotaryResult = r.process();
-  if (rotaryResult)  // change clock face number by rotation
+  int8_t steps = rotarySteps;  // 17.10.2026: rotation sampled in TaskYield() during a long screen update, + = clockwise
+  rotarySteps = 0;
+  if (rotaryResult == DIR_CW)       steps++;
+  else if (rotaryResult == DIR_CCW) steps--;
+
+  if (menuState != MENU_OFF)  // setup menu is open, 17.10.2026
   {
-    if (rotaryResult == DIR_CCW)  // Counter clockwise: decrease screen number
+    do {                      // one menu step per encoder step, also when there are none (push button)
+      rotaryResult = (steps > 0) ? DIR_CW : (steps < 0) ? DIR_CCW : 0;
+      steps -= (steps > 0) - (steps < 0);
+      RotarySetupStep(rotaryResult);
+    } while (steps != 0 && menuState != MENU_OFF);
+    return;
+  }
+  if (steps != 0)  // change clock face number by rotation
+  {
+    if (steps < 0)  // Counter clockwise: decrease screen number
     {
-      dispState = (dispState - 1) % noOfStates;    // decrement screen number
-      if (dispState < 0) dispState += noOfStates;  // roll-over if <0
+      dispState = (dispState + steps) % noOfStates;  // decrement screen number
+      if (dispState < 0) dispState += noOfStates;    // roll-over if <0
 #ifdef FEATURE_SERIAL_MENU
-      Serial.println(F("CCW"));
+      Serial.print(F("CCW ")); Serial.println(-steps);
 #endif
       //delay(50);
     } else  // Clockwise: increase screen number
     {
-      dispState = (dispState + 1) % noOfStates;
+      dispState = (dispState + steps) % noOfStates;
 #ifdef FEATURE_SERIAL_MENU
-      Serial.println(F("CW"));
+      Serial.print(F("CW ")); Serial.println(steps);
 #endif
       //delay(50);
     }
 
-    lcd.clear();
-    oldMinute = -1;  // to get immediate display of some info
+    InvalidateScreen();  // to get immediate display of some info
     lcd.setCursor(18, 3);
     PrintFixedWidth(lcd, dispState, 2);  // screen number temporarily in lower right-hand corner
     if (dispState == menuOrder[ScreenDemoClock]) {
       demoDispState = dispState;  // start demo
       demoDuration = 0;           // reset timer for time between screens in demo mode
     }
+    ScreenChanged();
   }
 
   if (r.buttonPressedReleased(500))  // 500 ms = long press for reset of processor
@@ -786,6 +1048,7 @@ void checkEncoder()  // check and read rotation and button of rotary encoder
     #ifndef ARDUINO_SAMD_VARIANT_COMPLIANCE
       lcd.clear();
       lcd.print(F(" *** R E S E T *** "));
+      lcd.show();
       delay(1000);
       resetFunc();  // call reset
     #endif  
@@ -807,14 +1070,14 @@ void checkEncoder()  // check and read rotation and button of rotary encoder
     // make sure native characters are loaded (for local language display in RotarySetup)
     loadNativeCharacters(languageNumber);
 
-    RotarySetup();   // call setup
-    oldMinute = -1;  // to get immediate display of some info.  09.08.2023
+    RotarySetup();   // open setup menu, it is then run by RotarySetupStep() above
   }
 }
 
 #ifdef FEATURE_BUTTONS  // may be in addition to rotary encoder
 void readButtons()      // read separate buttons (not the one in rotary encoder)
 {
+  if (menuState != MENU_OFF) return;  // setup menu is open, 17.10.2026
   byte button = AnalogButtonRead();  // using K3NG function
   if (button == 2) {                  // increase menu # by one
     dispState = (dispState + 1) % noOfStates;
@@ -822,11 +1085,11 @@ void readButtons()      // read separate buttons (not the one in rotary encoder)
       demoDispState = dispState;  // start demo
       demoDuration = 0;           // reset timer for time between screens in demo mode
     }
-    lcd.clear();
-    oldMinute = -1;  // to get immediate display of some info
-    delay(300);      // was 300
+    InvalidateScreen();  // to get immediate display of some info
     lcd.setCursor(18, 3);
     PrintFixedWidth(lcd, dispState, 2);  // lower left-hand corner
+    ScreenChanged();
+    delay(300);      // was 300
 
   } else if (button == 1) {  // decrease menu # by one
     dispState = (dispState - 1) % noOfStates;
@@ -836,10 +1099,10 @@ void readButtons()      // read separate buttons (not the one in rotary encoder)
       demoDispState = dispState;  // start demo
       demoDuration = 0;           // reset timer for time between screens in demo mode
     }
-    lcd.clear();
-    oldMinute = -1;  // to get immediate display of some info
+    InvalidateScreen();  // to get immediate display of some info
     lcd.setCursor(18, 3);
     lcd.print(dispState);
+    ScreenChanged();
     delay(300);
   }
 }
@@ -847,87 +1110,157 @@ void readButtons()      // read separate buttons (not the one in rotary encoder)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/*****
+Purpose: 
+Screens in ScreenSelect(), one entry per screen number of clock_defines.h, in that order. 17.10.2026
+Each entry: function and its argument, how often the content changes, custom characters, flags and
+estimated cost, see clock_defines.h. Screens without argument are called via a Face...() wrapper below.
+*****/
+
+void FaceLocalSunMoon(byte)  { LocalSunMoon(); }
+void FaceLocalSunAzEl(byte)  { LocalSunAzEl(); }
+void FaceLocalMoon(byte)     { LocalMoon(); }
+void FaceMoonRiseSet(byte)   { MoonRiseSet(); }
+void FaceTimeZones(byte)     { TimeZones(); }
+void FaceBar(byte)           { Bar(); }
+void FaceMengenLehrUhr(byte) { MengenLehrUhr(); }
+void FaceLinearUhr(byte)     { LinearUhr(); }
+void FaceInternalTime(byte)  { InternalTime(); }
+void FaceCodeStatus(byte)    { CodeStatus(); }
+void FaceUTCPosition(byte)   { UTCPosition(); }
+void FaceWSPRsequence(byte)  { WSPRsequence(); }
+void FaceEasterDates(byte)   { EasterDates(year()); }  // 20.8.2025:  was (yearGPS)
+void FaceLunarEclipse(byte)  { LunarEclipse(); }
+void FaceRoman(byte)         { Roman(); }
+void FaceMorse(byte)         { Morse(); }
+void FaceWordClock(byte)     { WordClock(); }
+void FaceSidereal(byte)      { Sidereal(); }
+void FaceISOHebIslam(byte)   { ISOHebIslam(); }
+void FaceGPSInfo(byte)       { GPSInfo(); }
+void FaceReminder(byte)      { Reminder(); }
+void FaceEquinoxes(byte)     { Equinoxes(); }
+void FaceSolarEclipse(byte)  { SolarEclipse(); }
+void FaceNextEvents(byte)    { NextEvents(); }
+void FaceProgress(byte)      { Progress(); }
+#ifdef FEATURE_PERF
+void FacePerf(byte)          { Perf(); }
+#endif
+void FaceGPSLink(byte)       { GPSLink(); }
+void FacePPS(byte)           { PPS(); }
+void FaceHoldover(byte)      { Holdover(); }
+
+const screen_type screens[] PROGMEM =
+{
+//  function,          arg, refresh,                         glyphs,                        flags,            cost
+  { LocalUTC,          0, REFRESH_SECOND,                  GLYPHS_NATIVE,                 0,                COST_LOW },    //  0 local time, date; UTC, locator
+  { UTCLocator,        1, REFRESH_SECOND,                  GLYPHS_NATIVE,                 SCREEN_NEEDS_FIX, COST_LOW },    //  1 UTC, locator, # sats
+  { LocalSun,          0, REFRESH_SECOND,                  GLYPHS_NATIVE | GLYPHS_ARROWS, SCREEN_NEEDS_FIX, COST_MEDIUM }, //  2 local time, sun x 3
+  { FaceLocalSunMoon,  0, REFRESH_SECOND | REFRESH_MINUTE, GLYPHS_NATIVE | GLYPHS_ARROWS, SCREEN_NEEDS_FIX, COST_HIGH },   //  3 local time, sun, moon
+  { FaceLocalMoon,     0, REFRESH_SECOND | REFRESH_MINUTE, GLYPHS_NATIVE | GLYPHS_ARROWS, SCREEN_NEEDS_FIX, COST_HIGH },   //  4 local time, moon size and elevation
+  { FaceMoonRiseSet,   0, REFRESH_MINUTE,                  GLYPHS_NATIVE | GLYPHS_ARROWS, SCREEN_NEEDS_FIX, COST_HIGH },   //  5 moon rises and sets at these times
+  { FaceTimeZones,     0, REFRESH_SECOND | REFRESH_MINUTE, 0,                             0,                COST_MEDIUM }, //  6 other time zones
+  { Binary,            2, REFRESH_SECOND,                  0,                             0,                COST_LOW },    //  7 binary, horizontal
+  { Binary,            1, REFRESH_SECOND,                  0,                             0,                COST_LOW },    //  8 BCD, horizontal
+  { Binary,            0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    //  9 BCD, vertical
+  { FaceBar,           0, REFRESH_SECOND,                  GLYPHS_BARS,                   0,                COST_LOW },    // 10 horizontal bar
+  { FaceMengenLehrUhr, 0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 11 set theory clock
+  { FaceLinearUhr,     0, REFRESH_SECOND,                  GLYPHS_BARS,                   0,                COST_LOW },    // 12 linear clock
+  { FaceInternalTime,  0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 13 internal time - for debugging
+  { FaceCodeStatus,    0, REFRESH_MINUTE,                  0,                             0,                COST_LOW },    // 14 version, options
+  { FaceUTCPosition,   0, REFRESH_SECOND,                  0,                             SCREEN_NEEDS_FIX, COST_LOW },    // 15 position
+  { NCDXFBeacons,      2, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 16 UTC + NCDXF beacons, 18-28 MHz
+  { NCDXFBeacons,      1, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 17 UTC + NCDXF beacons, 14-21 MHz
+  { FaceWSPRsequence,  0, REFRESH_SECOND,                  GLYPHS_GAPLESS,                0,                COST_LOW },    // 18 UTC + coordinated WSPR band/frequency
+  { HexOctalClock,     0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 19 hex clock
+  { HexOctalClock,     1, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 20 octal clock
+  { HexOctalClock,     3, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 21 3-in-1: hex-octal-binary clock
+  { FaceEasterDates,   0, REFRESH_DAY,                     0,                             0,                COST_LOW },    // 22 Gregorian and Julian Easter Sunday
+  { LocalSun,          3, REFRESH_SECOND,                  GLYPHS_NATIVE | GLYPHS_ARROWS, SCREEN_NEEDS_FIX, COST_MEDIUM }, // 23 local time, sun x 3 - simpler layout
+  { FaceLocalSunAzEl,  0, REFRESH_SECOND | REFRESH_MINUTE, GLYPHS_NATIVE | GLYPHS_ARROWS, SCREEN_NEEDS_FIX, COST_MEDIUM }, // 24 local time, sun az, el
+  { MathClock,         0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 25 math clock: add
+  { MathClock,         1, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 26 math clock: subtract/add
+  { MathClock,         2, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 27 math clock: multiply/subtract/add
+  { MathClock,         3, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 28 math clock: divide/multiply/subtract
+  { FaceLunarEclipse,  0, REFRESH_DAY,                     0,                             0,                COST_HIGH },   // 29 time for lunar eclipses
+  { FaceRoman,         0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 30 local time in Roman numerals
+  { FaceMorse,         0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 31 morse time
+  { FaceWordClock,     0, REFRESH_SECOND,                  GLYPHS_ARING,                  0,                COST_LOW },    // 32 time in clear text
+  { FaceSidereal,      0, REFRESH_SECOND,                  GLYPHS_NATIVE,                 SCREEN_NEEDS_FIX, COST_MEDIUM }, // 33 sidereal and solar time
+  { LocalUTC,          1, REFRESH_SECOND,                  GLYPHS_NATIVE,                 0,                COST_LOW },    // 34 local time, date; UTC, week #
+  { PlanetVisibility,  1, REFRESH_SECOND,                  0,                             SCREEN_NEEDS_FIX, COST_HIGH },   // 35 inner planet data
+  { PlanetVisibility,  0, REFRESH_SECOND,                  0,                             SCREEN_NEEDS_FIX, COST_HIGH },   // 36 outer planet data
+  { FaceISOHebIslam,   0, REFRESH_SECOND | REFRESH_DAY,    GLYPHS_ARROWS,                 0,                COST_HIGH },   // 37 ISO, Hebrew, Islamic calendar
+  { FaceGPSInfo,       0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 38 technical GPS info
+  { LocalUTC,          2, REFRESH_SECOND,                  GLYPHS_NATIVE,                 0,                COST_LOW },    // 39 local time + chemical element
+  { BigNumbers2,       0, REFRESH_SECOND,                  GLYPHS_3HIGH,                  0,                COST_LOW },    // 40 local time with big numbers
+  { BigNumbers2,       1, REFRESH_SECOND,                  GLYPHS_3HIGH,                  0,                COST_LOW },    // 41 UTC with big numbers
+  { BigNumbers3,       0, REFRESH_SECOND,                  GLYPHS_3WIDE,                  0,                COST_LOW },    // 42 local time with big numbers
+  { BigNumbers3,       1, REFRESH_SECOND,                  GLYPHS_3WIDE,                  0,                COST_LOW },    // 43 UTC with big numbers
+  { FaceReminder,      0, REFRESH_SECOND,                  0,                             0,                COST_MEDIUM }, // 44 dates to remember and elapsed time (from EEPROM)
+  { FaceEquinoxes,     0, REFRESH_10S,                     0,                             0,                COST_MEDIUM }, // 45 equinoxes, solstices
+  { FaceSolarEclipse,  0, REFRESH_DAY,                     0,                             0,                COST_MEDIUM }, // 46 time for solar eclipses
+  { FaceNextEvents,    0, REFRESH_MINUTE,                  0,                             0,                COST_HIGH },   // 47 next Easter, eclipse(s), equinox/solstice in sorted order
+  { FaceProgress,      0, REFRESH_SECOND | REFRESH_MINUTE, GLYPHS_FRAMEDBARS,             0,                COST_LOW },    // 48 date, time, progress bars for week, month, year
+  { LocalUTC,          3, REFRESH_SECOND,                  GLYPHS_NATIVE,                 0,                COST_LOW },    // 49 local time, abbreviated month with letters
+  { LocalUTC,          4, REFRESH_SECOND,                  GLYPHS_NATIVE,                 0,                COST_LOW },    // 50 local time and factorized minute, second
+#ifdef FEATURE_PERF
+  { FacePerf,          0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 51 execution time per task and screen
+#else
+  { NULL,              0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 51
+#endif
+  { FaceGPSLink,       0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 52 serial link from GPS: rates, RX buffer, errors
+  { FacePPS,           0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 53 PPS: frequency error, jitter, lag of MCU clock
+  { FaceHoldover,      0, REFRESH_SECOND,                  0,                             0,                COST_LOW },    // 54 holdover: time since sync, estimated error
+  { DemoClock,         0, REFRESH_SECOND,                  0,                             SCREEN_DEMO,      COST_HIGH },   // 55 demo, includes the screen it shows
+};
+static_assert(sizeof(screens) / sizeof(screens[0]) == noOfScreens, "screens[] must have one entry per screen number");
+
+/*****
+Purpose: 
+Properties of screen at menu position disp
+
+Argument List: int disp - position in menu, e.g. dispState
+               screen_type &screen - entry of screens[] is copied here
+
+Return value: false if there is no screen at this position
+*****/
+
+bool ScreenInfo(int disp, screen_type &screen) {
+  if (disp < 0 || disp >= noOfScreens || menuScreen[disp] >= sizeof(screens) / sizeof(screens[0])) return false;
+  memcpy_P(&screen, &screens[menuScreen[disp]], sizeof(screen));
+  return screen.function != NULL;
+}
+
+bool ScreenNeedsFix(int disp) {  // screen at menu position disp has nothing to show without GPS position
+  screen_type screen;
+  return ScreenInfo(disp, screen) && (screen.flags & SCREEN_NEEDS_FIX);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 void ScreenSelect(int disp, int DemoMode)  // menu System - called from inside loop [from updateTime()] and from DemoClock
 {
-  if (disp == menuOrder[ScreenLocalUTC])                LocalUTC(0);            // local time, date; UTC, locator
-  else if (disp == menuOrder[ScreenLocalUTCWeek])       LocalUTC(1);            // local time, date; UTC, week #
-  else if (disp == menuOrder[ScreenUTCLocator])         UTCLocator(1);          // UTC, locator, # sats
-
-  // Sun, moon:
-  else if (disp == menuOrder[ScreenLocalSun])           LocalSun(0);            // local time, sun x 3
-  else if (disp == menuOrder[ScreenLocalSunMoon])       LocalSunMoon();         // local time, sun, moon
-  else if (disp == menuOrder[ScreenLocalMoon])          LocalMoon();            // local time, moon size and elevation
-  else if (disp == menuOrder[ScreenMoonRiseSet])        MoonRiseSet();          // Moon rises and sets at these times
-
-  // Nice to have
-  else if (disp == menuOrder[ScreenTimeZones])          TimeZones();            // Other time zones
-
-  // Fancy, sometimes near unreadable displays, fun to program, and fun to look at:
-  else if (disp == menuOrder[ScreenBinary])             Binary(2);              // Binary, horizontal, display of time
-  else if (disp == menuOrder[ScreenBinaryHorBCD])       Binary(1);              // BCD, horizontal, display of time
-  else if (disp == menuOrder[ScreenBinaryVertBCD])      Binary(0);              // BCD vertical display of time
-  else if (disp == menuOrder[ScreenBar])                Bar();                  // horizontal bar
-  else if (disp == menuOrder[ScreenMengenLehrUhr])      MengenLehrUhr();        // set theory clock
-  else if (disp == menuOrder[ScreenLinearUhr])          LinearUhr();          // Linear clock
-  // debugging:
-  else if (disp == menuOrder[ScreenInternalTime])       InternalTime();       // Internal time - for debugging
-  else if (disp == menuOrder[ScreenCodeStatus])         CodeStatus();         //
-
-  // GPS Location
-  else if (disp == menuOrder[ScreenUTCPosition])        UTCPosition();        // position
-
-  // WSPR and beacons:
-  else if (disp == menuOrder[ScreenNCDXFBeacons2])      NCDXFBeacons(2);      // UTC + NCDXF beacons, 18-28 MHz
-  else if (disp == menuOrder[ScreenNCDXFBeacons1])      NCDXFBeacons(1);      // UTC + NCDXF beacons, 14-21 MHz
-  else if (disp == menuOrder[ScreenWSPRsequence])       WSPRsequence();  // UTC + Coordinated WSPR band/frequency (20 min cycle)
-
-  else if (disp == menuOrder[ScreenHex])                HexOctalClock(0);     // Hex clock
-  else if (disp == menuOrder[ScreenOctal])              HexOctalClock(1);     // Octal clock
-  else if (disp == menuOrder[ScreenHexOctalClock])      HexOctalClock(3);     // 3-in-1: Hex-Octal-Binary clock
-
-  else if (disp == menuOrder[ScreenEasterDates])        EasterDates(year()); // Gregorian and Julian Easter Sunday.  20.8.2025:  was (yearGPS)
-
-  else if (disp == menuOrder[ScreenLocalSunSimpler])    LocalSun(3);          // was (2); local time, sun x 3 - simpler layout
-  else if (disp == menuOrder[ScreenLocalSunAzEl])       LocalSunAzEl();       // local time, sun az, el
-
-  else if (disp == menuOrder[ScreenRoman])              Roman();              // Local time in Roman numerals
-  else if (disp == menuOrder[ScreenMathClockAdd])       MathClock(0);         // Math clock: add
-  else if (disp == menuOrder[ScreenMathClockSubtract])  MathClock(1);         // Math clock: subtract/add
-  else if (disp == menuOrder[ScreenMathClockMultiply])  MathClock(2);         // Math clock: multiply/subtract/add
-  else if (disp == menuOrder[ScreenMathClockDivide])    MathClock(3);         // Math clock: divide/multiply/subtract
-
-  else if (disp == menuOrder[ScreenLunarEclipse])       LunarEclipse();       // time for lunar eclipse
-  else if (disp == menuOrder[ScreenSidereal])           Sidereal();           // sidereal and solar time
-  else if (disp == menuOrder[ScreenMorse])              Morse();              // morse time
-  else if (disp == menuOrder[ScreenWordClock])          WordClock();          // time in clear text
-  else if (disp == menuOrder[ScreenGPSInfo])            GPSInfo();            // Show technical GPS Info
-  else if (disp == menuOrder[ScreenISOHebIslam])        ISOHebIslam();        // ISO, Hebrew, Islamic calendar
-  else if (disp == menuOrder[ScreenPlanetsInner])       PlanetVisibility(1);  // Inner planet data
-  else if (disp == menuOrder[ScreenPlanetsOuter])       PlanetVisibility(0);  // Inner planet data
-  else if (disp == menuOrder[ScreenChemical])           LocalUTC(2);          // local time + chemical element
-
-  else if (disp == menuOrder[ScreenBigNumbers2])        BigNumbers2(0);       // local time with big numbers
-  else if (disp == menuOrder[ScreenBigNumbers2UTC])     BigNumbers2(1);       // UTC with big numbers
-  else if (disp == menuOrder[ScreenBigNumbers3])        BigNumbers3(0);       // local time with big numbers
-  else if (disp == menuOrder[ScreenBigNumbers3UTC])     BigNumbers3(1);       // UTC with big numbers
-  else if (disp == menuOrder[ScreenReminder])           Reminder();           // Show dates to remember and elapsed time (from EEPROM) 
-  else if (disp == menuOrder[ScreenEquinoxes])          Equinoxes();          // Show equinoxes, solstices
-  else if (disp == menuOrder[ScreenSolarEclipse])       SolarEclipse();       // time for solar eclipses
-  else if (disp == menuOrder[ScreenNextEvents])         NextEvents();         // Show next Easter, eclipse(s), equinox/solstice in sorted order
-  else if (disp == menuOrder[ScreenProgress])           Progress();           // Date, time, progress bars for week, month, year 
-  else if (disp == menuOrder[ScreenLocalMonth])         LocalUTC(3);          // Local time, abbreviated month with letters
-  else if (disp == menuOrder[ScreenFactorization])      LocalUTC(4);          // Local time and factorized minute, second
-  else if (disp == menuOrder[ScreenDemoClock])  // last menu item
+  // 17.10.2026: menu position -> screen number -> entry of screens[], was a chain of if (disp == menuOrder[...])
+#ifdef FEATURE_PERF
+  uint32_t startMicros = micros();
+#endif
+  screen_type screen;
+  if (ScreenInfo(disp, screen))
   {
-    if (!DemoMode)                                      DemoClock(0);         // Start demo of all clock functions if not already in DemoMode
-    else                                                DemoClock(1);         // continue with demo mode
-  } else                          // Error handling, added 12.7.2023
+    if (!RefreshDue(screen.refresh)) return;  // nothing on this screen changes now, LCD buffer keeps it
+    if (screen.flags & SCREEN_DEMO) screen.arg = DemoMode;  // DemoClock(0): screen demoDispState, DemoClock(1): demo title
+    screen.function(screen.arg);
+  } 
+  else                          // Error handling, added 12.7.2023
   {
     lcd.setCursor(0, 0);
     lcd.print(F("Warning:"));
     lcd.setCursor(0, 1);
-    lcd.print(F("  Invalid screen #"));  // due to repeated entry in menuStruct[]
+    lcd.print(F("  Invalid screen #"));  // screen number not in screens[]
   }
+#ifdef FEATURE_PERF
+  PerfAdd(PerfScreenStage(disp), micros() - startMicros);
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -977,7 +1310,7 @@ void readEEPROM() {
   }
 
   baudRateNumber = EEPROM.read(EEPROM_OFFSET1 + 5);
-  if ((baudRateNumber < 0) || (baudRateNumber > int(sizeof(gpsBaud1) / sizeof(gpsBaud1[0])))) {
+  if ((baudRateNumber < 0) || (baudRateNumber >= int(sizeof(gpsBaud1) / sizeof(gpsBaud1[0])))) {  // 17.10.2026: was >
     baudRateNumber = COLDSTART_baudRateNumber;
     EEPROMMyupdate(EEPROM_OFFSET1 + 5, baudRateNumber, 1);
   } 
@@ -1022,6 +1355,18 @@ void readEEPROM() {
     Twelve24Local = COLDSTART_Twelve24Local; 
     EEPROMMyupdate(EEPROM_OFFSET1 + 12, Twelve24Local, 1);
   }
+  gpsProtocol = EEPROM.read(EEPROM_OFFSET1 + 13);  // new 17.10.2026
+  if (gpsProtocol != PROTOCOL_NMEA && gpsProtocol != PROTOCOL_UBX) {
+    gpsProtocol = COLDSTART_gpsProtocol;
+    EEPROMMyupdate(EEPROM_OFFSET1 + 13, gpsProtocol, 1);
+  }
+#ifndef GPS_CONFIG_UBLOX  // receiver is not told to send UBX, see clock_gpsconfig.h: clock would never sync
+  if (gpsProtocol == PROTOCOL_UBX) {
+    gpsProtocol = PROTOCOL_NMEA;
+    EEPROMMyupdate(EEPROM_OFFSET1 + 13, gpsProtocol, 1);
+  }
+#endif
+  WorldLoad();  // new 17.10.2026: zones of TimeZones(), EEPROM_OFFSET1 + 14 ... 30
   #ifdef FEATURE_SERIAL_EEPROM
     Serial.print("Twelve24Local ");
     Serial.println(Twelve24Local);
@@ -1084,6 +1429,7 @@ void setup() {
   else {
     lcd.print("Valid interrupt "); lcd.print(GPS_PPS);  // even for pin D4 for Metro??
   }
+  lcd.show();
   delay(1000);
 #endif
 
@@ -1098,26 +1444,20 @@ void setup() {
       Serial.begin(gpsBaud);            // for faking GPS data from software simulator
   #endif
 
+  GpsConfigure(GpsConfigWanted());  // 17.10.2026: RMC, GGA + GSA, GSV if ScreenGPSInfo is in menu, clock_gpsconfig.h
+
   attachInterrupt(digitalPinToInterrupt(GPS_PPS), ppsHandler, RISING);  // enable 1pps GPS time sync
  // works here for METRO: https://forum.arduino.cc/t/interrupt-not-being-called-in-arduino-m0-pro/485356 
 
   CodeStatus();  // show start screen
   lcd.setCursor(0, 3);
   lcd.print(F("..........    "));  // timezone info of start screen not yet set, so blank it out
+  lcd.show();
   delay(1000);
 
   dispState = 0;     // always start with screen # 0
   demoDuration = 0;  // reset counter for time between demo screens
 
-  // Initialize all the uninitialized TinyGPSCustom objects
-  for (int i = 0; i < 4; ++i)  // from SatelliteTracker (TinyGPS++ example)
-  {
-    satNumber[i].begin(gps, "GPGSV", 4 + 4 * i);  // offsets 4, 8, 12, 16
-    elevation[i].begin(gps, "GPGSV", 5 + 4 * i);  // offsets 5, 9, 13, 17
-    azimuth[i].begin(gps, "GPGSV", 6 + 4 * i);    // offsets 6, 10, 14, 18
-    snr[i].begin(gps, "GPGSV", 7 + 4 * i);        // offsets 7, 11, 15, 19
-  }
-
 // Serial output is only used for debugging:
 #ifdef FEATURE_SERIAL_PLANETARY
   Serial.begin(115200);
@@ -1189,26 +1529,41 @@ void setup() {
 #ifdef FEATURE_DATE_PER_SECOND  // for stepping date quickly and check calender function
   dateIteration = 0;
 #endif
+
+#ifdef FEATURE_SERIAL_TASKS
+  Serial.begin(115200);
+  Serial.println(F("Task scheduler debug"));
+#endif
+#ifdef FEATURE_PERF
+  Serial.begin(115200);
+  Serial.println(F("Perf: 'p' = dump, 'r' = reset, 'f' = LCD frame"));
+#endif
+#ifdef FEATURE_SERIAL_FRAMES
+  Serial.begin(115200);
+  Serial.println(F("LCD frames"));
+#endif
+#ifdef FEATURE_NMEA_REPLAY
+  Serial.begin(115200);
+  Serial.println(F("NMEA replay"));
+#endif
+
+  InitTasks();  // scheduler for the tasks of loop()
 }
 
 ////////////////////////////////////// L O O P //////////////////////////////////////////////////////////////////
 
 void loop() {
-  readGPS();        // decode incoming GPS
-  GPSParse();       // GPS statuscode snippet from TinyGPSParse.ino
-  syncCheck();      // set time with interrupt (or without interrupt)
-  updateDisplay();  // select function for selected screen
-  checkEncoder();   // check and read rotary encoder + its button
-
+  RunTasks();       // 17.10.2026: in order of priority, see tasks[] in clock_scheduler.h:
+                    //   readGPS()       decode incoming GPS
+                    //   checkEncoder()  check and read rotary encoder + its button
+                    //   syncCheck()     set time with interrupt (or without interrupt)
+                    //   GPSParse()      GPS statuscode snippet from TinyGPSParse.ino
+                    //   updateDisplay() select function for selected screen
+                    //   readButtons()   separate buttons, in support of old user interface (FEATURE_BUTTONS)
   
   #ifdef FEATURE_INTERRUPTTEST
     digitalWrite(LED_BUILTIN, state);
   #endif
-
-  // In support of old user interface with buttons:
-#ifdef FEATURE_BUTTONS  // separate buttons which may be in addition to rotary encoder
-  readButtons();
-#endif  // FEATURE_BUTTONS
 }
 
 ////////////////////////////////////// END LOOP //////////////////////////////////////////////////////////////////
@@ -1228,26 +1583,18 @@ void LocalUTC(  // local time, UTC, no of satetllites,
                 // 4 for Prime and factorization of seconds instead of UTC
 ) {             
 
-#ifndef FEATURE_DATE_PER_SECOND
-  localTime = now() + utcOffset * 60;  // in seconds since 1970
-
-#else  // for stepping date quickly and check calender function
-  localTime = now() + utcOffset * 60 + dateIteration * SPEED_UP_FACTOR; // fake local time by stepping per day
-  dateIteration = dateIteration + 1;
-//  Serial.print(dateIteration); Serial.print(": ");
-//  Serial.println(local);
-#endif
+  localTime = moment.local;  // in seconds since 1970. 17.10.2026: FEATURE_DATE_PER_SECOND steps it in MomentFill()
 loadNativeCharacters(languageNumber);
 
 // ********* **********
   
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
-  if (Twelve24Local > 12) Hour = hour(localTime);  // 24 hr clock
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;  // 24 hr clock
   else  {
     Hour = hourFormat12(localTime);
-    if (oldMinute == -1 || 
+    if (RefreshDue(REFRESH_FIRST) || 
       ( (Hour==0 || Hour == 12) && Minute == 00 && Seconds == 0) ) {   // load am/pm symbol as seldom as possible into lcd
       if (isAM(localTime)) {
         memcpy_P(buffer, am, 8);                 // am symbol (clashes with Norse, Faroese char set)
@@ -1287,9 +1634,9 @@ loadNativeCharacters(languageNumber);
   }
 
   // local date
-  Day = day(localTime);
-  Month = month(localTime);
-  Year = year(localTime);
+  Day = moment.localTm.Day;
+  Month = moment.localTm.Month;
+  Year = tmYearToCalendar(moment.localTm.Year);
   //if (dayGPS != 0)        // was this (26.05.2023)
   //if (gps.date.isValid()) // same slow response as old test (26.05.2023)
   {
@@ -1310,8 +1657,6 @@ loadNativeCharacters(languageNumber);
     lcd.setCursor(0, 1);  //////// line 2
 
     if (mode == 1) { // option added 3.9.2022 - ISO week # on second line
-      GregorianDate a(month(localTime), day(localTime), year(localTime));
-      IsoDate ISO(a);
       if       (strcmp(languages[languageNumber], "nb ")==0) lcd.print(F("Uke "));
       else if  (strcmp(languages[languageNumber], "da ")==0) lcd.print(F("Uge "));
       else if  (strcmp(languages[languageNumber], "nn ")==0) lcd.print(F("Veke "));
@@ -1323,7 +1668,7 @@ loadNativeCharacters(languageNumber);
       else if  (strcmp(languages[languageNumber], "es ")==0) lcd.print(F("Semana "));
       else lcd.print(F("Week "));  // also Dutch
 
-      lcd.print(ISO.GetWeek());
+      lcd.print(moment.isoWeek);  // 17.10.2026: was IsoDate ISO(a) every second
       lcd.print(" ");  // added space 15.01.2023 - needed for 1-digit week numbers
     }
 
@@ -1357,11 +1702,8 @@ loadNativeCharacters(languageNumber);
     {
       lcd.setCursor(0, 1);
      
-      Timezone tzLocal;
-      time_t local;
       TimeChangeRule *tcrLocal;
-      tzLocal = *timeZones_arr[timeZoneNumber];
-      local = tzLocal.toLocal(utc, &tcrLocal);
+      TzLocal(timeZoneNumber, utc, &tcrLocal);  // 17.10.2026: was a copy of Timezone object
       lcd.print(tcrLocal->abbrev); lcd.print(F(" "));
 
       lcd.setCursor(9, 1);
@@ -1474,22 +1816,21 @@ loadNativeCharacters(languageNumber);
       lcd.print(F("                    "));
 
       lcd.setCursor(0, 3);
-      sprintf(textBuffer, "%02d%c%02d%c%02d UTC ", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()), dateTimeFormat[dateFormat].minSep, second(now()));
+      sprintf(textBuffer, "%02d%c%02d%c%02d UTC ", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute, dateTimeFormat[dateFormat].minSep, moment.utcTm.Second);
       lcd.print(textBuffer);
 
 #ifdef FEATURE_SERIAL_GPS
 //    Serial.println(textBuffer);
 #endif
 
-      if (gps.satellites.isUpdated()) {
-        noSats = gps.satellites.value();
+      if (gnss.satellites.isUpdated()) {
+        noSats = gnss.satellites.value();
         lcd.setCursor(13, 3);
       } else noSats = 0;
       PrintFixedWidth(lcd, noSats, 2);
       lcd.print(F(" Sats"));
     }
   }
-  oldMinute = minuteGPS;
 }
 
 // Menu item //////////////////////////////////////////////////////////////////////////////////////////
@@ -1510,12 +1851,12 @@ void UTCLocator(  // UTC, locator, # satellites
   //  if (gps.time.isValid())
   if (mode==0)
   { 
-    sprintf(textBuffer, "%02d%c%02d%c%02d         UTC", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()), dateTimeFormat[dateFormat].minSep, second(now()));
+    sprintf(textBuffer, "%02d%c%02d%c%02d         UTC", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute, dateTimeFormat[dateFormat].minSep, moment.utcTm.Second);
     lcd.print(textBuffer);
   }
   else  // mode == 1
   {
-    sprintf(textBuffer, "%02d%c%02d%c%02d", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()), dateTimeFormat[dateFormat].minSep, second(now()));
+    sprintf(textBuffer, "%02d%c%02d%c%02d", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute, dateTimeFormat[dateFormat].minSep, moment.utcTm.Second);
     lcd.print(textBuffer);
     #ifdef UTC_ENGLISH_DAY_NAME        // New 27.2.2024: English
       sprintf(todayFormatted, "%12s", dayStr(weekdayGPS));   // print right-justified : fixed 09.10.2024
@@ -1546,24 +1887,17 @@ void UTCLocator(  // UTC, locator, # satellites
   lcd.setCursor(10, 1);
   LcdDate(day(), month(), year()); //  20.8.2025: LcdDate(dayGPS, monthGPS, yearGPS);
 
-  if (gps.location.isValid()) {
-
-  #ifndef DEBUG_MANUAL_POSITION
-      latitude = gps.location.lat();
-      lon = gps.location.lng();
-  #else
-      latitude = latitude_manual;
-      lon = longitude_manual;
-  #endif
-
-  Maidenhead(lon, latitude, textBuffer);
+  if (position.valid) {
+  static char locator[7];          // 17.10.2026: only computed when position.version changes, clock_position.h
+  static uint16_t locatorVersion = 0;
+  if (PositionChanged(locatorVersion)) Maidenhead(position.lon, position.lat, locator);
   lcd.setCursor(0, 3);  // last line *********
-  lcd.print(textBuffer);
+  lcd.print(locator);
   lcd.print(F("       "));
   }
   //  if (gps.satellites.()) { // 16.11.2022
-  if (gps.satellites.isUpdated()) {
-    noSats = gps.satellites.value();
+  if (gnss.satellites.isUpdated()) {
+    noSats = gnss.satellites.value();
     lcd.setCursor(13, 3);
   } else noSats = 0;
 
@@ -1592,14 +1926,8 @@ void LocalSun(  // local time, sun x 3
   // else LcdTimeLocalShortDayDate(0,0);
 
 //  if (gps.location.isValid()) {
-//    if (minuteGPS != oldMinute) {
-#ifndef DEBUG_MANUAL_POSITION
-      latitude = gps.location.lat();
-      lon = gps.location.lng();
-#else
-      latitude = latitude_manual;
-      lon = longitude_manual;
-#endif
+//    if (RefreshDue(REFRESH_MINUTE)) {
+      PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
 
   if (mode == 0) {
     LcdSolarRiseSet(1, ' ', ScreenLocalSun);
@@ -1665,7 +1993,6 @@ void LocalSun(  // local time, sun x 3
 //   }
 // }
   }
-  oldMinute = minuteGPS;
 }
 
 
@@ -1688,22 +2015,15 @@ void LocalSunAzEl() {  // local time, sun x 3
   LcdShortDayDateTimeLocal(0, 0);  // line 0
   //LcdTimeLocalShortDayDate(0,0);
 
-  if (gps.location.isValid()) {
-    if (minuteGPS != oldMinute) {
-#ifndef DEBUG_MANUAL_POSITION
-      latitude = gps.location.lat();
-      lon = gps.location.lng();
-#else
-      latitude = latitude_manual;
-      lon = longitude_manual;
-#endif
+  if (position.valid) {
+    if (RefreshDue(REFRESH_MINUTE)) {
+      PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
 
       LcdSolarRiseSet(1, ' ', ScreenLocalSunAzEl);  // Actual Rise, Set times<
       LcdSolarRiseSet(2, 'O', ScreenLocalSunAzEl);  //Noon info
       LcdSolarRiseSet(3, 'Z', ScreenLocalSunAzEl);  //Current Az El info
     }
   }
-  oldMinute = minuteGPS;
 }
 
 /*****
@@ -1725,16 +2045,10 @@ void LocalSunMoon() {  // local time, sun, moon
   LcdShortDayDateTimeLocal(0, 0);  // line 0, (was time offset 2) to the left
   //LcdTimeLocalShortDayDate(0,0);
 
-  if (gps.location.isValid()) {
-    if (minuteGPS != oldMinute) {
+  if (position.valid) {
+    if (RefreshDue(REFRESH_MINUTE)) {
 
-#ifndef DEBUG_MANUAL_POSITION
-      latitude = gps.location.lat();
-      lon = gps.location.lng();
-#else
-      latitude = latitude_manual;
-      lon = longitude_manual;
-#endif
+      PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
 
       LcdSolarRiseSet(1, ' ', ScreenLocalSunMoon);  // line 1, Actual rise time
                                                     //      LcdSolarRiseSet(2, 'C', 0); // line 2
@@ -1756,8 +2070,8 @@ void LocalSunMoon() {  // local time, sun, moon
 #endif
 
       localTime = now() + utcOffset * 60;
-      Hour = hour(localTime);
-      Minute = minute(localTime);
+      Hour = moment.localTm.Hour;
+      Minute = moment.localTm.Minute;
 
       //int packedTime = Hour * 100 + Minute;
 
@@ -1809,7 +2123,6 @@ void LocalSunMoon() {  // local time, sun, moon
       lcd.write(DEGREE);
     }
   }
-  oldMinute = minuteGPS;
 }
 
 /*****
@@ -1831,8 +2144,8 @@ void LocalMoon() {  // local time, moon phase, elevation, next rise/set
   LcdShortDayDateTimeLocal(0, 0);  // line 0, (was 1 position left) to line up with next lines
   //LcdTimeLocalShortDayDate(0,0);
 
-  if (gps.location.isValid()) {
-    if (minuteGPS != oldMinute) {  // update display every minute
+  if (position.valid) {
+    if (RefreshDue(REFRESH_MINUTE)) {  // update display every minute
 
       // days since last new moon
       float Phase, PercentPhase;
@@ -1863,13 +2176,7 @@ void LocalMoon() {  // local time, moon phase, elevation, next rise/set
       PrintFixedWidth(lcd, (int)(abs(round(PercentPhase))), 3);
       lcd.print("%");
 
-#ifndef DEBUG_MANUAL_POSITION
-      latitude = gps.location.lat();
-      lon = gps.location.lng();
-#else
-      latitude = latitude_manual;
-      lon = longitude_manual;
-#endif
+      PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
 
       lcd.setCursor(0, 1);  // line 1
 
@@ -1898,8 +2205,8 @@ void LocalMoon() {  // local time, moon phase, elevation, next rise/set
           pSet = -1;                // the moon rises and never sets
       */
       localTime = now() + utcOffset * 60;
-      Hour = hour(localTime);
-      Minute = minute(localTime);
+      Hour = moment.localTm.Hour;
+      Minute = moment.localTm.Minute;
 
      // int packedTime = Hour * 100 + Minute;
 
@@ -1934,7 +2241,6 @@ void LocalMoon() {  // local time, moon phase, elevation, next rise/set
         lcd.write(DEGREE);
       } else lcd.print(F("  No Rise/Set       "));
 
-      oldMinute = minuteGPS;
     }
   }
 }
@@ -1955,24 +2261,18 @@ void MoonRiseSet(void) {
   loadNativeCharacters(languageNumber); // added 09.10.2024
   loadArrowCharacters();
 
-  if (gps.location.isValid()) {
+  if (position.valid) {
 
-#ifndef DEBUG_MANUAL_POSITION
-    latitude = gps.location.lat();
-    lon = gps.location.lng();
-#else
-    latitude = latitude_manual;
-    lon = longitude_manual;
-#endif
+    PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
 
-    if (minuteGPS != oldMinute) {
+    if (RefreshDue(REFRESH_MINUTE)) {
 
       short pRise, pSet, pRise2, pSet2, packedTime;  // time in compact format '100*hr + min'
       double rAz, sAz, rAz2, sAz2;
 
       localTime = now() + utcOffset * 60;
-      Hour = hour(localTime);
-      Minute = minute(localTime);
+      Hour = moment.localTm.Hour;
+      Minute = moment.localTm.Minute;
 
       packedTime = Hour * 100 + Minute;  // local time 19.11.2021
 
@@ -2182,7 +2482,6 @@ void MoonRiseSet(void) {
       lcd.print(F("  "));
     }
   }
-  oldMinute = minuteGPS;
 }
 
 // Menu item ///////////////////////////////////////////////////////////////////////////////////////////
@@ -2195,12 +2494,10 @@ void lcdTimeZone(byte zoneNumber)  // display time on LCD in desired time zone.
   // This reads both the daylight and standard time rules previously stored at EEPROM address 100:
   // Timezone usPacific(100);
 
-  Timezone tzLocal;
   time_t local;
   TimeChangeRule *tcrLocal;
 
-  tzLocal = *timeZones_arr[zoneNumber];
-  local = tzLocal.toLocal(utc, &tcrLocal);
+  local = TzLocal(zoneNumber, utc, &tcrLocal);  // 17.10.2026: was a copy of Timezone object
   Hour = hour(local);
   Minute = minute(local);
   sprintf(textBuffer, "%02d%c%02d ", Hour, dateTimeFormat[dateFormat].hourSep, Minute);
@@ -2210,6 +2507,7 @@ void lcdTimeZone(byte zoneNumber)  // display time on LCD in desired time zone.
 
 /*****
 Purpose: Display time in 6 time zones on LCD, 4 user selectable
+17.10.2026: up to 16 user selectable zones, 4 per page, new page every 10 s. See clock_worldclock.h
 
 Argument List: none
 
@@ -2221,37 +2519,41 @@ void TimeZones() {  // local time, UTC, + 4 more time zones (user selectable)
 
   // show local time in many locations
 
-  lcd.setCursor(0, 0);  // 1. line ********* always time zone set for clock
-  lcdTimeZone(timeZoneNumber);
-
   lcd.setCursor(17, 0);  // end of line 1 shows seconds
-  Seconds = second(localTime);
+  Seconds = moment.localTm.Second;
   sprintf(textBuffer, "%c%02d", dateTimeFormat[dateFormat].minSep, Seconds);
   lcd.print(textBuffer);
 
-  lcd.setCursor(0, 1);  // 2. line  always UTC *********
-  sprintf(textBuffer, "%02d%c%02d UTC  ", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()));
-  lcd.print(textBuffer);
-
-  // First user selectable (e.g. China Standard Time)
-  lcd.setCursor(0, 2);  // ******** 3. line
-  lcdTimeZone(16);
-
-  // Second user selectable (e.g. Indian Standard Time)
-  lcd.setCursor(10, 2);
-  lcdTimeZone(17);
+  if (RefreshDue(REFRESH_MINUTE)) {  // 17.10.2026: time zone conversions only when minute changes
+    lcd.setCursor(0, 0);  // 1. line ********* always time zone set for clock
+    lcdTimeZone(timeZoneNumber);
 
-  // Third user selectable (e.g. US Eastern Time Zone)
-  lcd.setCursor(0, 3);  //////// line 4
-  lcdTimeZone(3);
+    lcd.setCursor(0, 1);  // 2. line  always UTC *********
+    sprintf(textBuffer, "%02d%c%02d UTC  ", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute);
+    lcd.print(textBuffer);
+  }
 
-  // Fourth user selectable (e.g. Pacific US)
-  lcd.setCursor(10, 3);
-  lcdTimeZone(7);
+  // 3. and 4. line: user selectable, 17.10.2026: was lcdTimeZone() for userTimeZones[0..3] every minute
+  if (WorldUpdate(utc) || RefreshDue(REFRESH_MINUTE)) {
+    for (byte i = 0; i < WORLD_PER_PAGE; i++) {
+      lcd.setCursor(10 * (i % 2), 2 + i / 2);
+      if (world.tz[i].zone < 0) {
+        lcd.print(F("          "));  // no more zones in list
+        continue;
+      }
+      sprintf(textBuffer, "%02d%c%02d %-4s", world.hour[i], dateTimeFormat[dateFormat].hourSep, world.minute[i], world.tz[i].rule.abbrev);
+      lcd.print(textBuffer);
+    }
 
-  lcd.setCursor(19, 3);
-  lcd.print(" ");  // blank out rest of menu number in lower right-hand corner
-  oldMinute = minuteGPS;
+    lcd.setCursor(17, 1);  // page no
+    if (WorldPages() > 1) {
+      sprintf(textBuffer, "%d/%d", world.page + 1, WorldPages());
+      lcd.print(textBuffer);
+    }
+    else lcd.print(F("   "));
+    lcd.setCursor(19, 3);
+    lcd.print(" ");  // blank out rest of menu number in lower right-hand corner
+  }
 }
 
 // Menu item ////////////////////////////////////////
@@ -2275,10 +2577,10 @@ void Binary(byte mode) {  // binary local time
 
   // get local time
   localTime = now() + utcOffset * 60;
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   // convert to BCD
 
@@ -2433,8 +2735,8 @@ void Bar(void) {
 
   localTime = now() + utcOffset * 60;
   Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   // use a 12 character bar  just like a 12 hour clock with ticks every hour
   // for second ticks use ' " % #
@@ -2516,10 +2818,10 @@ void MengenLehrUhr(void) {
 
   // get local time
   localTime = now() + utcOffset * 60;
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   lcd.setCursor(0, 0);
   // top line has 5 hour resolution
@@ -2665,10 +2967,10 @@ void LinearUhr(void) {
 
   // get local time
   localTime = now() + utcOffset * 60;
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   lcd.setCursor(0, 0);
   // top line has 10 hour resolution
@@ -2757,15 +3059,15 @@ Return value: Displays on LCD
 void InternalTime() {  // UTC, Unix time, J2000, etc
 
   lcd.setCursor(0, 0);  // top line *********
-  if (gps.time.isValid()) {
+  if (gnss.time.isValid()) {
 
     float jd1970 = now() / 86400.0;  // cdn(now()); // now/86400, i.e. no of days since 1970 [No leap seconds]
-    float j2000 = jd1970 - 10957.5;  // 1- line
+    float j2000 = (moment.jd - 2451545.0) + moment.jdFrac;  // 1- line. 17.10.2026: was jd1970 - 10957.5, fewer digits lost
     lcd.print(F("j2k "));
     lcd.print(j2000);
 
     lcd.setCursor(12, 0);
-    sprintf(textBuffer, "%02d%c%02d%c%02d UTC ", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()), dateTimeFormat[dateFormat].minSep, second(now()));
+    sprintf(textBuffer, "%02d%c%02d%c%02d UTC ", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute, dateTimeFormat[dateFormat].minSep, moment.utcTm.Second);
     lcd.print(textBuffer);
 
     lcd.setCursor(0, 2);
@@ -2773,15 +3075,16 @@ void InternalTime() {  // UTC, Unix time, J2000, etc
     lcd.print(jd1970,3);
    
     lcd.setCursor(0, 1);
-    Seconds = second(now());
-    Minute = minute(now());
-    Hour = hour(now());
-    Day = day(now());
-    Month = month(now());
-    Year = year(now());
+    Seconds = moment.utcTm.Second;
+    Minute = moment.utcTm.Minute;
+    Hour = moment.utcTm.Hour;
+    Day = moment.utcTm.Day;
+    Month = moment.utcTm.Month;
+    Year = tmYearToCalendar(moment.utcTm.Year);
 
     // new 9.2.2024
-    jd = get_julian_date(Day, Month, Year, Hour, Minute, Seconds);  // local - since year 4713 BC
+    jd = moment.jd;          // UTC - since year 4713 BC. 17.10.2026: was get_julian_date(Day, Month, Year, Hour, Minute, Seconds)
+    jd_frac = moment.jdFrac;
     
     lcd.print(F("jd   "));
     lcd.print(jd,1);lcd.print("+"); lcd.print(jd_frac,3);  // more accurate
@@ -2813,8 +3116,11 @@ void CodeStatus(void) {
   lcd.print(codeVersion);
   //lcd.setCursor(0, 2); lcd.print(F("GPS  ")); lcd.print(gpsBaud); lcd.print(" bps");
   lcd.setCursor(0, 2);
-  lcd.print(F("GPS "));
-  lcd.print(gpsBaud1[baudRateNumber]); lcd.print(F(" bps,"));
+  if (gpsProtocol == PROTOCOL_UBX) lcd.print(F("UBX "));  // 17.10.2026
+  else                             lcd.print(F("GPS "));
+  lcd.print(gpsBaud1[baudRateNumber]); 
+  if (gpsBaud1[baudRateNumber] < 100000) lcd.print(F(" bps,"));  // 17.10.2026: 20 chars also at 115200
+  else                                   lcd.print(F(" bps"));
   if (using_PPS)  lcd.print(F(" PPS on")); // changed format 1.1.2025
   else            lcd.print(F(" no PPS")); 
   lcd.setCursor(0, 3);
@@ -2826,6 +3132,65 @@ void CodeStatus(void) {
   lcd.print(F("   "));
 }
 
+#ifdef FEATURE_PERF
+/*****
+Purpose: Menu item
+Execution time of tasks and screens, one stage at a time, changes every 3 seconds. 
+Only stages which have run are shown
+
+Argument List: None
+
+Return value: Displays on LCD
+*****/
+
+void Perf(void) {  // new 17.10.2026
+  byte noActive = 0;
+  for (byte i = 0; i < NO_OF_PERF_STAGES; i++)
+    if (perf[i].count > 0) noActive++;
+  if (noActive == 0) return;
+
+  byte shown = (now() / 3) % noActive;
+  byte page = shown;
+  byte stage = 0;
+  for (stage = 0; stage < NO_OF_PERF_STAGES; stage++)
+    if (perf[stage].count > 0 && page-- == 0) break;
+  perf_type *p = &perf[stage];
+
+  lcd.setCursor(0, 0);
+  PerfStageName(stage);
+  lcd.print(textBuffer);
+  sprintf(textBuffer, "  n%8u", (unsigned int)p->count);
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 1);
+  lcd.print(F("min")); PerfPrintMicros(lcd, p->minMicros);
+  lcd.print(F("  max")); PerfPrintMicros(lcd, p->maxMicros);
+
+  lcd.setCursor(0, 2);
+  lcd.print(F("avg")); PerfPrintMicros(lcd, p->avgMicros);
+  if (stage >= PERF_SCREEN0 && stage < PERF_PPS_LCD) {  // bytes/s to LCD
+    lcd.print(F(" B"));
+    PrintFixedWidth(lcd, perfLcdBytes[stage - PERF_SCREEN0] / 16, 3);
+  }
+  else lcd.print(F("     "));
+  sprintf(textBuffer, " %2d/%-2d", shown + 1, noActive);
+  lcd.print(textBuffer);
+
+  // histogram scaled to 0...9, bins: <256us <1ms <4ms <16ms <65ms <262ms <1s >1s
+  byte histMax = 1;
+  for (byte k = 0; k < PERF_BINS; k++)
+    if (p->hist[k] > histMax) histMax = p->hist[k];
+  lcd.setCursor(0, 3);
+  lcd.print(F("hist"));
+  for (byte k = 0; k < PERF_BINS; k++)
+  {
+    lcd.print(F(" "));
+    if (p->hist[k] == 0) lcd.print(F("."));
+    else                 lcd.print(1 + (8 * (p->hist[k] - 1)) / histMax);
+  }
+}
+#endif
+
 /*****
 Purpose: Menu item
 Gives UTC time, locator, latitude/longitude, altitude and no of satellites
@@ -2840,17 +3205,9 @@ void UTCPosition() {  // position, altitude, locator, # satellites
 
   LcdUTCTimeLocator(0, 1);  // top line ********* start 1 position right - in order to line up with latitude/longitude
   // UTC date
-  if (gps.location.isValid()) {
+  if (position.valid) {
 
-#ifndef DEBUG_MANUAL_POSITION
-    latitude = gps.location.lat();
-    lon = gps.location.lng();
-    alt = gps.altitude.meters();
-#else
-    latitude = latitude_manual;
-    lon = longitude_manual;
-    alt = 0.0;
-#endif
+    PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
 
     int cycleTime = 10;  // 4.10.2022: was 4 seconds
 
@@ -2953,8 +3310,8 @@ void UTCPosition() {  // position, altitude, locator, # satellites
   lcd.print(F(" m"));
 
   //  if (gps.satellites.isValid()) { // 16.11.2022
-  if (gps.satellites.isUpdated()) {
-    noSats = gps.satellites.value();
+  if (gnss.satellites.isUpdated()) {
+    noSats = gnss.satellites.value();
     if (noSats < 10) lcd.setCursor(14, 3);
     else lcd.setCursor(13, 3);
   } else {
@@ -3104,9 +3461,9 @@ void HexOctalClock(byte val) {
 
   //  get local time
   localTime = now() + utcOffset * 60;
-  Hour = hour(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Hour = moment.localTm.Hour;
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   lcd.setCursor(0, 0);
   if (val == 0) lcd.print(F("Hex   "));
@@ -3207,7 +3564,7 @@ void EasterDates(int yr) {
   lcd.setCursor(0, 0);
   lcd.print(F("Easter  Greg. Julian"));
 
-  if (minuteGPS != oldMinute) {
+  if (RefreshDue(REFRESH_DAY)) {
 
     for (int yer = yr; yer < yr + 3; yer++) {
       lcd.setCursor(2, ii);
@@ -3231,7 +3588,6 @@ void EasterDates(int yr) {
       ii++;
     }
   }
-  oldMinute = minuteGPS;
 }
 
 
@@ -3256,17 +3612,17 @@ void MathClock(byte LevelMath) {
 
   //  get local time
   localTime = now() + utcOffset * 60;
-  Hour = hour(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Hour = moment.localTm.Hour;
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
 
-  if (now() % mathSecondPeriod == 0 || oldMinute == -1)  // ever so often + immediate start
+  if (now() % mathSecondPeriod == 0 || RefreshDue(REFRESH_FIRST))  // ever so often + immediate start
   {
 
 #ifdef FEATURE_SERIAL_MATH
-    Serial.print(F("oldMinute, Seconds, mathSecondPeriod: "));
-    Serial.print(oldMinute);
+    Serial.print(F("refreshDue, Seconds, mathSecondPeriod: "));
+    Serial.print(refreshDue, HEX);
     Serial.print(":");
     Serial.print(Seconds);
     Serial.print(", ");
@@ -3404,7 +3760,6 @@ void MathClock(byte LevelMath) {
 
   //lcd.setCursor(18, 3); lcd.print(F("  "));
 
-  oldMinute = minuteGPS;
 }
 
 /*****
@@ -3423,7 +3778,7 @@ void LunarEclipse() {
   int pday, pmonth, yy;
   int i;
 
-  if (minuteGPS != oldMinute) {
+  if (RefreshDue(REFRESH_DAY)) {
 
 
     lcd.setCursor(0, 0);
@@ -3516,7 +3871,6 @@ void LunarEclipse() {
       lcd.setCursor(18, 3);
       lcd.print(F("  "));  // erase lower right-hand corner if not already done
     }
-    oldMinute = Minute;
   }
 }
 
@@ -3548,10 +3902,10 @@ void Roman() {
 
   //  get local time
   localTime = now() + utcOffset * 60;
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   ones = Hour % 10;
   tens = (Hour - ones) / 10;
@@ -3613,11 +3967,10 @@ void Sidereal()  // LST - Local Sidereal Time - updated 26.12.2024
 {
   double LST_hours, LST_degrees;
 
-  float jd1970 = now() / 86400.0;  // cdn(now()); // now/86400, i.e. no of days since 1970
-  float j2000 = jd1970 - 10957.5;  // 1- line
+  float j2000 = (moment.jd - 2451545.0) + moment.jdFrac;  // days since J2000. 17.10.2026: was now() / 86400.0 - 10957.5, fewer digits lost
 
-  double decimal_time = hour(now()) + (minute(now()) / 60.0) + (second(now()) / 3600.0);
-  double LST = 100.46 + 0.985647 * j2000 + gps.location.lng() + 15 * decimal_time;
+  double decimal_time = moment.utcTm.Hour + (moment.utcTm.Minute / 60.0) + (moment.utcTm.Second / 3600.0);
+  double LST = 100.46 + 0.985647 * j2000 + position.lon + 15 * decimal_time;  // 17.10.2026: was gnss.location.lng()
   LST_degrees = (LST - (floor(LST / 360) * 360));
   LST_hours = LST_degrees / 15;
 
@@ -3635,7 +3988,7 @@ void Sidereal()  // LST - Local Sidereal Time - updated 26.12.2024
   //LcdShortDayDateTimeLocal(0, 0);  // line 0 local time
 
   lcd.setCursor(0, 0);
-  sprintf(textBuffer, "UTC         %02d%c%02d%c%02d", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()), dateTimeFormat[dateFormat].minSep, second(now()));
+  sprintf(textBuffer, "UTC         %02d%c%02d%c%02d", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute, dateTimeFormat[dateFormat].minSep, moment.utcTm.Second);
   lcd.print(textBuffer);
 
   // put this last display line second in code - better for Metro - otherwise "Si" is printed again on line 1 and "dereal" again on line 2
@@ -3649,8 +4002,8 @@ void Sidereal()  // LST - Local Sidereal Time - updated 26.12.2024
   // local time on line 1
   localTime = now() + utcOffset * 60;
   lcd.setCursor(4,1);
-  sprintf(textBuffer, "        %02d%c%02d%c%02d", hour(localTime), dateTimeFormat[dateFormat].hourSep, minute(localTime), 
-          dateTimeFormat[dateFormat].minSep, second(localTime));
+  sprintf(textBuffer, "        %02d%c%02d%c%02d", moment.localTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.localTm.Minute, 
+          dateTimeFormat[dateFormat].minSep, moment.localTm.Second);
   lcd.print(textBuffer);
 
   lcd.setCursor(0, 2);
@@ -3670,11 +4023,7 @@ void Sidereal()  // LST - Local Sidereal Time - updated 26.12.2024
   // new test with Wikipedia method:
   // rel https://fate.windada.com/cgi-bin/SolarTime_en: 35 sec too fast: 2 sec 3-4 sec faster
 
-  #ifndef DEBUG_MANUAL_POSITION    
-      lon = gps.location.lng();  // new 27.12.2024 
-  #else
-      lon = longitude_manual;
-  #endif
+  PositionGet();  // 17.10.2026: was lon = gnss.location.lng() or longitude_manual, new 27.12.2024 
   double tc = 4.0 * lon + tv;  // correction in minutes: Deviation from center of time zone + Equation of Time
   time_t solar;
   
@@ -3691,11 +4040,8 @@ void Sidereal()  // LST - Local Sidereal Time - updated 26.12.2024
 
 // must for some reason be last for Metro
   lcd.setCursor(0,1);
-  Timezone tzLocal;
-  time_t local;
   TimeChangeRule *tcrLocal;
-  tzLocal = *timeZones_arr[timeZoneNumber];
-  local = tzLocal.toLocal(utc, &tcrLocal);
+  TzLocal(timeZoneNumber, utc, &tcrLocal);  // 17.10.2026: was a copy of Timezone object
   lcd.print(tcrLocal->abbrev);
   
 // #ifdef ARDUINO_SAMD_VARIANT_COMPLIANCE
@@ -3773,10 +4119,10 @@ void Morse()  // time in Morse code on LCD
 
   //  get local time
   localTime = now() + utcOffset * 60;
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   ones = Hour % 10;
   tens = (Hour - ones) / 10;
@@ -3848,10 +4194,10 @@ void WordClockEnglish() {
 
   //  get local time
   localTime = now() + utcOffset * 60;
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   lcd.setCursor(0, 0);
   if (Hour < 10) {
@@ -3994,25 +4340,20 @@ void PlanetVisibility(byte inner  // inner = 1 for inner planets, all other valu
   // Julian day ref noon Universal Time (UT) Monday, 1 January 4713 BC in the Julian calendar:
   //jd = get_julian_date (20, 1, 2017, 17, 0, 0);//UTC
 
-  if (gps.location.isValid())  // new 24.09.2024 - avoid giving planet positions for lat, lon = (0.0, 0.0)
+  if (position.valid)  // new 24.09.2024 - avoid giving planet positions for lat, lon = (0.0, 0.0)
   {
 
-    #ifndef DEBUG_MANUAL_POSITION    // new 24.09.2024 - avoid giving planet positions for lat, lon = (0.0, 0.0)
-      latitude = gps.location.lat();
-      lon = gps.location.lng();
-    #else
-      latitude = latitude_manual;
-      lon = longitude_manual;
-    #endif
+      PositionGet();  // 17.10.2026: latitude, lon, alt from position snapshot, clock_position.h
   
-    Seconds = second(now());
-    Minute = minute(now());
-    Hour = hour(now());
-    Day = day(now());
-    Month = month(now());
-    Year = year(now());
+    Seconds = moment.utcTm.Second;
+    Minute = moment.utcTm.Minute;
+    Hour = moment.utcTm.Hour;
+    Day = moment.utcTm.Day;
+    Month = moment.utcTm.Month;
+    Year = tmYearToCalendar(moment.utcTm.Year);
 
-    jd = get_julian_date(Day, Month, Year, Hour, Minute, Seconds);  // local - since year 4713 BC
+    jd = moment.jd;          // UTC - since year 4713 BC. 17.10.2026: was get_julian_date(Day, Month, Year, Hour, Minute, Seconds)
+    jd_frac = moment.jdFrac;
 
   #ifdef FEATURE_SERIAL_PLANETARY
     Serial.println("JD:" + String(jd, DEC) + "+" + String(jd_frac, DEC));  // jd = 2457761.375000;
@@ -4105,10 +4446,7 @@ startTime = millis();  // // new 09.10.2024, keep track of time in order to comp
 loadArrowCharacters();
 
 #ifdef FEATURE_DATE_PER_SECOND                                 // for stepping date quickly and check calender function
-  localTime = now() + utcOffset * 60 + dateIteration * SPEED_UP_FACTOR;  // fake local time by stepping up to 1 sec/day
-  dateIteration = dateIteration + 1;
-//  Serial.print(dateIteration); Serial.print(": ");
-//  Serial.println(localTime);
+  localTime = moment.local;  // 17.10.2026: stepped in MomentFill()
 #endif
 
   // algorithms in Nachum Dershowitz and Edward M. Reingold, Calendrical Calculations,
@@ -4117,7 +4455,7 @@ loadArrowCharacters();
 
   lcd.setCursor(0, 0);  // top line *********
   // all dates are in local time
-  GregorianDate a(month(localTime), day(localTime), year(localTime));
+  GregorianDate a(moment.localTm.Month, moment.localTm.Day, tmYearToCalendar(moment.localTm.Year));
   LcdDate(a.GetDay(), a.GetMonth(), a.GetYear());
   ////    Serial.print("Absolute date ");Serial.println(a);
     
@@ -4145,7 +4483,7 @@ loadArrowCharacters();
 
     localTime = now() + utcOffset * 60; // added 3.2.2024 - less latency in time calculation as routine is entered and at full minute
     lcd.setCursor(11,0);
-    sprintf(textBuffer, "%02d%c%02d%c%02d ", hour(localTime), dateTimeFormat[dateFormat].hourSep, minute(localTime), dateTimeFormat[dateFormat].minSep, second(localTime));
+    sprintf(textBuffer, "%02d%c%02d%c%02d ", moment.localTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.localTm.Minute, dateTimeFormat[dateFormat].minSep, moment.localTm.Second);
     lcd.print(textBuffer);
 
     lcd.setCursor(11, 2);
@@ -4159,7 +4497,6 @@ loadArrowCharacters();
   else
   {
     lcd.setCursor(10, 0); 
-    IsoDate ISO(a);
     // if      (strcmp(languages[languageNumber], "nb ")==0) lcd.print(F(" Uke    "));
     // else if (strcmp(languages[languageNumber], "da ")==0) lcd.print(F(" Uge    "));
     // else if (strcmp(languages[languageNumber], "nn ")==0) lcd.print(F(" Veke   "));
@@ -4167,7 +4504,7 @@ loadArrowCharacters();
     // else if (strcmp(languages[languageNumber], "is ")==0) lcd.print(F(" Vika   "));
     // else                                                 
     lcd.print(F(" Week   "));
-    lcd.print(ISO.GetWeek());
+    lcd.print(moment.isoWeek);  // 17.10.2026: was IsoDate ISO(a)
     
     lcd.setCursor(11,2);
     if (mIsl > 0) lcd.print(reinterpret_cast<const __FlashStringHelper *>(IslamicMonth[mIsl - 1]));
@@ -4177,12 +4514,12 @@ loadArrowCharacters();
     else          lcd.print(F("         "));
   }
   
-  lcd.setCursor(0, 2);
-  IslamicDate Isl(a);
-  mIsl = Isl.GetMonth();
-  LcdDate(Isl.GetDay(), mIsl, Isl.GetYear());  
+  if (RefreshDue(REFRESH_DAY)) {  // update rest of display initially and then every day, was every minute
+    lcd.setCursor(0, 2);
+    IslamicDate Isl(a);
+    mIsl = Isl.GetMonth();
+    LcdDate(Isl.GetDay(), mIsl, Isl.GetYear());  
 
-  if (minuteGPS != oldMinute) {  // update rest of display initially and then every minute
     // Hebrew calendar is complicated and *** very *** slow - takes ~3 sec on Arduino Mega. 
     // Therefore it is on the last line and only done occasionally
     // means that ~3 updates of increments to 'demoDuration' are missed (i.e. seconds)
@@ -4192,7 +4529,6 @@ loadArrowCharacters();
       mHeb = Heb.GetMonth();
       lcd.setCursor(0, 3); LcdDate(Heb.GetDay(), mHeb, Heb.GetYear());
   }
-  oldMinute = minuteGPS;
   elapsedTime = millis() - startTime;   // new 09.10.2024, estimate elapsed time in routine
 }
 
@@ -4221,22 +4557,19 @@ void GPSInfo() {
 
   // GPSParse();
 
-  if (totalGPGSVMessages.isValid()) {
+  if (nmea.gsvTotal != 0) {  // $GPGSV received, clock_nmea.h
 
     //  https://github.com/mikalhart/TinyGPSPlus/issues/52
 
-    int totalMessages = atoi(totalGPGSVMessages.value());
-    int currentMessage = atoi(messageNumber.value());
-
-    if (totalMessages == currentMessage) {
+    if (nmea.gsvNumber == nmea.gsvTotal) {
     #ifdef FEATURE_SERIAL_GPS
       Serial.print(F("Sats in use = "));
-      Serial.print(gps.satellites.value());
+      Serial.print(gnss.satellites.value());
       Serial.print(F(" Nums = "));
 
       for (int i = 0; i < MAX_SATELLITES; ++i) {
-        if (sats[i].active) {
-          Serial.print(i + 1);
+        if (sats[i].prn != 0 && sats[i].system == NMEA_GP) {
+          Serial.print(sats[i].prn);
           Serial.print(F(" "));
         }
       }
@@ -4266,12 +4599,10 @@ void GPSInfo() {
 
     lcd.setCursor(0, 0);
     lcd.print(F("In view "));
-    //int noSats =  GPsatsInView.value(); PrintFixedWidth(lcd, min(noSats,99), 2);
-    if ((int)GPsatsInView.value() < 10) lcd.print(" ");
-    lcd.print(GPsatsInView.value());
+    PrintFixedWidth(lcd, nmea.inView[NMEA_GP], 2);
     lcd.print(F(" Sats "));
 
-    noSats = gps.satellites.value();  // in list of http://arduiniana.org/libraries/tinygpsplus/
+    noSats = gnss.satellites.value();  // in list of http://arduiniana.org/libraries/tinygpsplus/
     lcd.setCursor(0, 1);
     lcd.print(F("In fix  "));  //printFixedWidth(lcd, noSats, 2);
     PrintFixedWidth(lcd, noSats, 2);
@@ -4280,17 +4611,17 @@ void GPSInfo() {
 
    
     lcd.print(F(" SNR "));
-    PrintFixedWidth(lcd, round(SNRAvg), 2);
+    PrintFixedWidth(lcd, SatSNRAvg(NMEA_GP), 2);  // 17.10.2026: GPS only, clock_satellites.h
     lcd.print(F(" dB"));
     //#endif
     //
     lcd.setCursor(0, 2);
     lcd.print(F("Mode    "));
-    lcd.print(GPSMode.value());
+    lcd.print(nmea.gpsMode ? nmea.gpsMode : ' ');
     lcd.print(F("D Status  "));
-    lcd.print(GPSposStatus.value());
+    lcd.print(nmea.gpsStatus ? nmea.gpsStatus : ' ');
 
-    hdop = gps.hdop.hdop();  // in list of http://arduiniana.org/libraries/tinygpsplus/
+    hdop = gnss.hdop.hdop();  // in list of http://arduiniana.org/libraries/tinygpsplus/
     lcd.setCursor(0, 3);
     lcd.print(F("Hdop  "));
     lcd.print(hdop);
@@ -4305,24 +4636,22 @@ void GPSInfo() {
     Serial.print(F("TotalSats="));
     Serial.print(totalSats);
     Serial.print(F(" InView="));
-    Serial.print(GPsatsInView.value());
+    Serial.print(nmea.inView[NMEA_GP]);
     Serial.print(F(" In Fix="));
     Serial.print(noSats);
 
     Serial.print(F(" SNRAvg="));
     Serial.print((int)SNRAvg);
     Serial.print(F(" Mode="));
-    Serial.print(GPSMode.value());  // 1-none, 2=2D, 3=3D
+    Serial.print(nmea.gpsMode);  // 1-none, 2=2D, 3=3D
     Serial.print(F(" Status="));
-    Serial.print(GPSposStatus.value());  // A-valid, V-invalid
+    Serial.print(nmea.gpsStatus);  // A-valid, V-invalid
     Serial.println();
   #endif
 
-    for (int i = 0; i < MAX_SATELLITES; ++i)
-      sats[i].active = false;
     //
     // removed 22.5.2023: made the display blink between valid values and 0 values as update doesn't happen every second
-  }  // if (totalGPGSVMessages.isUpdated())
+  }  // if (nmea.gsvTotal != 0)
 
   //  else                              // new 19.11.2022, purpose? show loss of signal?
   //  {
@@ -4336,22 +4665,19 @@ void GPSInfo() {
 
 #else // GNSS - 2.4.2025
 
-  if (totalGPGSVMessages.isValid()) {
+  if (nmea.gsvTotal != 0) {  // $GPGSV received, clock_nmea.h
 
     //  https://github.com/mikalhart/TinyGPSPlus/issues/52
 
-    int totalMessages = atoi(totalGPGSVMessages.value());
-    int currentMessage = atoi(messageNumber.value());
-
-    if (totalMessages == currentMessage) {
+    if (nmea.gsvNumber == nmea.gsvTotal) {
     #ifdef FEATURE_SERIAL_GPS
           Serial.print(F("Sats in use = "));
-          Serial.print(gps.satellites.value());
+          Serial.print(gnss.satellites.value());
           Serial.print(F(" Nums = "));
 
           for (int i = 0; i < MAX_SATELLITES; ++i) {
-            if (sats[i].active) {
-              Serial.print(i + 1);
+            if (sats[i].prn != 0) {
+              Serial.print(sats[i].prn);
               Serial.print(F(" "));
             }
           }
@@ -4361,7 +4687,7 @@ void GPSInfo() {
 
     lcd.setCursor(0, 0);
     lcd.print(F("In view "));
-    int noSats = atoi(GPsatsInView.value()) + atoi(GLsatsInView.value()) + atoi(GBsatsInView.value()) + atoi(GBsatsInView.value());
+    int noSats = nmea.inView[NMEA_GP] + nmea.inView[NMEA_GL] + nmea.inView[NMEA_GA] + nmea.inView[NMEA_GB];  // 17.10.2026: was GB twice, no GA
     PrintFixedWidth(lcd, noSats, 2);
     // if ((int)GPsatsInView.value() < 10) lcd.print(" ");
     // lcd.print(GPsatsInView.value());
@@ -4370,7 +4696,7 @@ void GPSInfo() {
     // lcd.print(noSats);  
     lcd.print(F(" Sats "));
 
-    noSats = gps.satellites.value();  // in list of http://arduiniana.org/libraries/tinygpsplus/
+    noSats = gnss.satellites.value();  // in list of http://arduiniana.org/libraries/tinygpsplus/
     lcd.setCursor(0, 1);
     lcd.print(F("In fix  "));
     PrintFixedWidth(lcd, noSats, 2);
@@ -4384,17 +4710,19 @@ void GPSInfo() {
       //
 
 // lines 3-4, first 5 seconds
-  if (now() % 10 < 5) {
+  if (now() % 15 < 5) {
     lcd.setCursor(0, 2);
     lcd.print(F("Mode    "));
-    if (strlen(GNSSMode.value()) != 0) lcd.print(GNSSMode.value()); // GNSS?
-    else                               lcd.print(GPSMode.value());  // or GPS?
+    if (nmea.gnssMode != 0)     lcd.print(nmea.gnssMode);  // GNSS?
+    else if (nmea.gpsMode != 0) lcd.print(nmea.gpsMode);   // or GPS?
+    else                        lcd.print(' ');
 
     lcd.print(F("D Status  "));
-    if (strlen(GNSSposStatus.value()) != 0) lcd.print(GNSSposStatus.value()); // GNSS?
-    else                                    lcd.print(GPSposStatus.value());  // or GPS?
+    if (nmea.gnssStatus != 0)     lcd.print(nmea.gnssStatus);  // GNSS?
+    else if (nmea.gpsStatus != 0) lcd.print(nmea.gpsStatus);   // or GPS?
+    else                          lcd.print(' ');
 
-    hdop = gps.hdop.hdop();  // in list of http://arduiniana.org/libraries/tinygpsplus/
+    hdop = gnss.hdop.hdop();  // in list of http://arduiniana.org/libraries/tinygpsplus/
     lcd.setCursor(0, 3);
     lcd.print(F("Hdop  "));
     lcd.print(hdop);
@@ -4404,27 +4732,19 @@ void GPSInfo() {
     else if (hdop < 5) lcd.print(F(" Good     "));
     else               lcd.print(F(" No good  "));
   }
-  else  // lines 3-4, next 5 seconds. New 2.4.2025
+  else  // lines 3-4, next 10 seconds: per constellation, tracked/in view, then average SNR. New 2.4.2025, 17.10.2026
   {
-    lcd.setCursor(0,2);  lcd.print(F("GPS:    "));
-    PrintFixedWidth(lcd,atoi(GPsatsInView.value()),2);
-    lcd.print(F(" "));
-
-    lcd.setCursor(11,2); lcd.print(F("Gal:   "));
-    PrintFixedWidth(lcd,atoi(GAsatsInView.value()),2);
-
-    lcd.setCursor(0,3);  lcd.print(F("Glo:    "));
-    PrintFixedWidth(lcd,atoi(GLsatsInView.value()),2);
-    lcd.print(F(" "));
-
-    lcd.setCursor(11,3); lcd.print(F("Bei:   "));
-    PrintFixedWidth(lcd,atoi(GBsatsInView.value()),2);
+    static const char systemName[NMEA_SYSTEMS][4] = {"GPS", "Glo", "Gal", "Bei"};  // order of NMEA_GP ... in clock_nmea.h
+    for (byte system = 0; system < NMEA_SYSTEMS; system++)
+    {
+      lcd.setCursor(system < 2 ? 0 : 10, 2 + system % 2);  // GPS, Gal on line 3, Glo, Bei on line 4
+      if (now() % 15 < 10) sprintf(textBuffer, "%s %2d/%2d ", systemName[system], satSystems[system].tracked, nmea.inView[system]);
+      else                 sprintf(textBuffer, "%s %2d dB ", systemName[system], SatSNRAvg(system));
+      lcd.print(textBuffer);
+    }
   }
 
-    for (int i = 0; i < MAX_SATELLITES; ++i)
-      sats[i].active = false;
-      
- }  // if (totalGPGSVMessages.isUpdated())
+ }  // if (nmea.gsvTotal != 0)
 
 #endif // GPSONLY - 2.4.2025
 
@@ -4435,6 +4755,141 @@ void GPSInfo() {
 
 }
 
+///////////////////////////////////////////////////////////////////////////////////////
+/*****
+Purpose: Menu item
+Health of serial link from GPS, see clock_gpslink.h:
+  line 1: bytes/s, highest fill of RX buffer of serial port
+  line 2: sentences/s per type
+  line 3: totals of checksum errors, sentences cut off, gaps in data from GPS
+  line 4: longest time between reads of the serial port / time to fill the RX buffer. 
+          If longer: # of screen which was shown then, i.e. which causes loss of data
+Rates are for the last second, line 1 and 4 for the last 10-20 seconds
+
+Argument List: None
+
+Return value: Displays on LCD
+*****/
+
+void GPSLink() {  // new 17.10.2026
+  lcd.setCursor(0, 0);
+  sprintf(textBuffer, "Rx%5uB/s  buf %3u%%", gpsLink.bytesPerSec, (unsigned)((100UL * LinkRxMax()) / LINK_RX_BUFFER));
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 1);  // e.g. "RMC1 GGA1 GSA4 GSV12"
+  byte column = 0;
+  for (byte type = 0; type < LINK_TYPES; type++)
+  {
+    if (gpsLink.sentencesPerSec[type] == 0) continue;
+    sprintf(textBuffer, "%s%s%u", column > 0 ? " " : "", linkTypeName[type], gpsLink.sentencesPerSec[type]);
+    if (column + strlen(textBuffer) > 20) break;  // no room for more types
+    column += strlen(textBuffer);
+    lcd.print(textBuffer);
+  }
+  for (; column < 20; column++) lcd.print(' ');
+
+  lcd.setCursor(0, 2);
+  sprintf(textBuffer, "Chk%4u Cut%3u Gap%2u", (unsigned)min(gpsProtocol == PROTOCOL_UBX ? ubx.failedChecksum : gps.failedChecksum(), 9999UL), min(gpsLink.cut, (uint16_t)999), min(gpsLink.gaps, (uint16_t)99));
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 3);
+  byte screen;
+  uint16_t waitMs = LinkWaitMax(screen);
+  uint16_t fillMs = LinkFillMs();
+  sprintf(textBuffer, "Poll%5u/%4ums", waitMs, min(fillMs, (uint16_t)9999));
+  lcd.print(textBuffer);
+  if (waitMs <= fillMs)           lcd.print(F("  ok"));
+  else if (screen == NO_SCREEN)   lcd.print(F(" #--"));
+  else
+  {
+    lcd.print(F(" #"));             // screen which held up readGPS(), data may be lost
+    PrintFixedWidth(lcd, screen, 2);
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/*****
+Purpose: Menu item
+MCU clock measured with the PPS pulse, see clock_pps.h:
+  line 1: consecutive good PPS intervals, intervals out of tolerance (lost pulses)
+  line 2: frequency error of MCU clock, ppm
+  line 3: jitter of PPS intervals, average and max of the last 1-2 minutes, us
+  line 4: lag from PPS pulse to setTime(), us, and quantization error of PPS pulse with UBX protocol, ns
+
+Argument List: None
+
+Return value: Displays on LCD
+*****/
+
+void PPS() {  // new 17.10.2026
+  lcd.setCursor(0, 0);
+  if (using_PPS) 
+  {
+    sprintf(textBuffer, "PPS %s%6u lost%3u", ppsPhase.pulses > 0 ? "ok" : "--", ppsPhase.pulses, min(ppsPhase.lost, (uint16_t)999));
+    lcd.print(textBuffer);
+  }
+  else lcd.print(F("PPS off             "));
+
+  lcd.setCursor(0, 1);
+  char ppm[10];
+  dtostrf(ppsPhase.ppm, 9, 2, ppm);
+  sprintf(textBuffer, "Freq %s ppm ", ppm);
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 2);
+  sprintf(textBuffer, "Jitter%5u max%5u", (unsigned)(ppsPhase.jitter + 0.5), max(ppsPhase.jitterMax, ppsPhase.jitterMaxLast));
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 3);
+  sprintf(textBuffer, "Lag%7lu us", ppsPhase.lag < 9999999UL ? (unsigned long)ppsPhase.lag : 9999999UL);
+  lcd.print(textBuffer);
+  if (gpsProtocol == PROTOCOL_UBX)
+  {
+    sprintf(textBuffer, " q%4ldns", (long)constrain(ubx.qErr / 1000, -999L, 9999L));  // TIM-TP, ps -> ns
+    lcd.print(textBuffer);
+  }
+  else lcd.print(F("        "));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////
+/*****
+Purpose: Menu item
+Holdover when GPS is lost, see clock_holdover.h:
+  line 1: holdover no and "no GPS", or how much of the frequency error average has been learned
+  line 2: time since last time from GPS, h:mm:ss
+  line 3: in holdover: estimated error, us. Else: error measured with first PPS pulse after last holdover
+  line 4: learned frequency error of MCU clock which is corrected for in holdover, ppm
+
+Argument List: None
+
+Return value: Displays on LCD
+*****/
+
+void Holdover() {  // new 17.10.2026
+  lcd.setCursor(0, 0);
+  if (holdover.active)  sprintf(textBuffer, "Holdover #%-3u no GPS", min(holdover.count, (uint16_t)999));
+  else if (using_PPS)   sprintf(textBuffer, "GPS ok  learned %3u%%", (unsigned)((100UL * holdover.samples) / HOLDOVER_FILTER));
+  else                  sprintf(textBuffer, "GPS ok, PPS off     ");
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 1);
+  uint32_t since = (millis() - holdover.lastSyncMillis) / 1000;
+  sprintf(textBuffer, "Last sync %3lu:%02u:%02u", min(since / 3600, 999UL), (unsigned)((since / 60) % 60), (unsigned)(since % 60));
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 2);
+  if (holdover.active)           sprintf(textBuffer, "Est error%8lu us", min(HoldoverError(), 99999999UL));
+  else if (holdover.errorMeasured) sprintf(textBuffer, "Last err%9ld us", (long)holdover.lastError);
+  else                           sprintf(textBuffer, "Last err        --  ");
+  lcd.print(textBuffer);
+
+  lcd.setCursor(0, 3);
+  char ppm[10];
+  dtostrf(holdover.ppm, 8, 2, ppm);
+  sprintf(textBuffer, "Corr %s ppm   ", ppm);
+  lcd.print(textBuffer);
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////////
 /*****
@@ -4455,9 +4910,9 @@ void BigNumbers3(byte showUTC) {
   loadThreeWideDigits();  // load 8 user-defined characterS if not loaded
 
   if (showUTC == 1) {
-    Hour = hour(now());
-    Minute = minute(now());
-    Seconds = second(now());
+    Hour = moment.utcTm.Hour;
+    Minute = moment.utcTm.Minute;
+    Seconds = moment.utcTm.Second;
     
     #ifdef STEP_FASTER
       Minute = minute(speedTime);
@@ -4465,16 +4920,16 @@ void BigNumbers3(byte showUTC) {
       speedTime += 60;  // increment half or one minute per second
     #endif
 
-    Day = day(now());
-    Month = month(now());
-    Year = year(now());
+    Day = moment.utcTm.Day;
+    Month = moment.utcTm.Month;
+    Year = tmYearToCalendar(moment.utcTm.Year);
   } else {
     // get local time
     localTime = now() + utcOffset * 60;
-    if (Twelve24Local > 12) Hour = hour(localTime);
+    if (Twelve24Local > 12) Hour = moment.localTm.Hour;
     else                    Hour = hourFormat12(localTime);
-    Minute = minute(localTime);
-    Seconds = second(localTime);
+    Minute = moment.localTm.Minute;
+    Seconds = moment.localTm.Second;
    
     #ifdef STEP_FASTER
       Minute = minute(speedTime + utcOffset * 60);
@@ -4482,9 +4937,9 @@ void BigNumbers3(byte showUTC) {
       speedTime += 60;  // increment half or one minute per second
     #endif
 
-    Day = day(localTime);
-    Month = month(localTime);
-    Year = year(localTime);
+    Day = moment.localTm.Day;
+    Month = moment.localTm.Month;
+    Year = tmYearToCalendar(moment.localTm.Year);
   }
 
   imax = Hour / 10; 
@@ -4559,24 +5014,24 @@ void BigNumbers2(byte showUTC) {
 
   loadThreeHighDigits2();  // load 8 user-defined characterS if not already loaded
   if (showUTC == 1) {
-    Hour = hour(now());
-    Minute = minute(now());
-    Seconds = second(now());
+    Hour = moment.utcTm.Hour;
+    Minute = moment.utcTm.Minute;
+    Seconds = moment.utcTm.Second;
 
-    Day = day(now());
-    Month = month(now());
-    Year = year(now());
+    Day = moment.utcTm.Day;
+    Month = moment.utcTm.Month;
+    Year = tmYearToCalendar(moment.utcTm.Year);
   } else {
     // get local time
     localTime = now() + utcOffset * 60;
-    if (Twelve24Local > 12) Hour = hour(localTime);
+    if (Twelve24Local > 12) Hour = moment.localTm.Hour;
     else                    Hour = hourFormat12(localTime);
-    Minute = minute(localTime);
-    Seconds = second(localTime);
+    Minute = moment.localTm.Minute;
+    Seconds = moment.localTm.Second;
 
-    Day = day(localTime);
-    Month = month(localTime);
-    Year = year(localTime);
+    Day = moment.localTm.Day;
+    Month = moment.localTm.Month;
+    Year = tmYearToCalendar(moment.localTm.Year);
   }
 
   imax = Hour / 10; // draw 10's hour digit
@@ -4685,8 +5140,7 @@ void Reminder()  //
 
   if (strcmp(languages[languageNumber], "nb ") == 0 || strcmp(languages[languageNumber], "nn ") == 0)
     { 
-      loadAring();  // Å for Norwegian 
-      yearSymbol = char(SCAND_aa_SMALL);  // Scandinavian å
+      yearSymbol = char(lcd.glyph(AA_small));  // Scandinavian å, in whichever slot it is or fits, 17.10.2026
     }
   else yearSymbol = 'y';                  // 'English for 'year' = default
 
@@ -4732,7 +5186,7 @@ void Reminder()  //
   
 // display sorted data on LCD:
 
-  if (oldMinute == -1) // first use of Reminder() always outputs first rows of dates. New test 25.12.2024
+  if (RefreshDue(REFRESH_FIRST)) // first use of Reminder() always outputs first rows of dates. New test 25.12.2024
   {
     indStart = 0; 
     secondInternal = 0; // set reference time. New variable 25.12.2024
@@ -4788,7 +5242,6 @@ void Reminder()  //
       lcd.print(F("                    "));  // blank line when there is no more data to display
     }
   }
-  oldMinute = minuteGPS;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4803,23 +5256,13 @@ Argument List: none
 Return value: Displays on LCD
 *****/
 
-int displayYear;
-
 void Equinoxes() {
 
-int year1 = year(now());
+int year1 = tmYearToCalendar(moment.utcTm.Year);
 int year2 = year1 + 2;
-if (oldMinute == -1)                    // first call of Equinox()
-    secondInternal = 0;                 // set reference time. New variable 03.01.2025
-else                  
-    secondInternal = secondInternal +1; // update if program has just been in this routine
 
-if (oldMinute == -1 || displayYear < year1) displayYear = year1-1;
-
-if (secondInternal % 10 == 0) {      // increment every x seconds
-  displayYear = displayYear+1;
-  if (displayYear > year2) displayYear = year1;
-}
+// new year every 10 seconds, see screens[]. 17.10.2026: from the time, not counted per call, which depends on how often the screen is drawn
+int displayYear = year1 + (moment.utc / 10) % (year2 - year1 + 1);
 
 EquinoxSolstice(displayYear);
 
@@ -4856,7 +5299,6 @@ EquinoxSolstice(displayYear);
   sprintf(textBuffer, " %02d%c%02d", hour(tt), dateTimeFormat[dateFormat].hourSep, minute(tt));
   lcd.print(textBuffer); 
 
-  oldMinute = minuteGPS;
 }
 
 
@@ -4910,7 +5352,7 @@ void SolarEclipse() {
   lcd.setCursor(0, 0);
   lcd.print(F("Solar Eclipses "));
 
-  yy = year(now());
+  yy = tmYearToCalendar(moment.utcTm.Year);
   noSolarEclipses = sizeof(solarEclipse) / sizeof(solarEclipse[0]);
   int lineNo = 1;
 
@@ -5243,7 +5685,7 @@ void Progress()
     int8_t UTCPlus1 = (hourGPS + 1)%24;
     float beats = 3600.0*UTCPlus1 + 60.0*minuteGPS + secondGPS;
   #else // follows local time (makes it more useful)
-    float beats = 3600.0*hour(localTime) + 60.0*minute(localTime) + second(localTime);
+    float beats = 3600.0*moment.localTm.Hour + 60.0*moment.localTm.Minute + moment.localTm.Second;
   #endif
 
   beats = beats/86.4;
@@ -5257,7 +5699,7 @@ void Progress()
   #endif
 
 
-if (minuteGPS != oldMinute) {  // only update once per minute in order to avoid blink
+if (RefreshDue(REFRESH_MINUTE)) {  // only update once per minute in order to avoid blink
    loadCurvedFramedBarCharactersA();     // ( xxxx )
 
 // Progress bars
@@ -5269,14 +5711,12 @@ if (minuteGPS != oldMinute) {  // only update once per minute in order to avoid
     lcd.setCursor(0,2);lcd.print(F("Wk"));    
 // week number 
     lcd.setCursor(3, 2); 
-    GregorianDate a(month(localTime), day(localTime), year(localTime));
-    IsoDate ISO(a);
-    PrintFixedWidth(lcd, ISO.GetWeek(), 3);
+    PrintFixedWidth(lcd, moment.isoWeek, 3);  // 17.10.2026: was IsoDate ISO(a)
 
-    byte wkday = weekday(localTime);                  // weekly progress. Day of the week (1-7), Sunday is day 1
+    byte wkday = moment.localTm.Wday;                  // weekly progress. Day of the week (1-7), Sunday is day 1
     wkday = 1 + (wkday - firstDayWeek + 7) % 7;  
 
-    float sNoReal = 5.0 * (float)hour(localTime) / 24.0;  //
+    float sNoReal = 5.0 * (float)moment.localTm.Hour / 24.0;  //
     int sNoInt = 5*(wkday-1) + (int)(1+sNoReal); // 1 to round up, 32-> 6+2 subsegments. 31->6 only???
 
     framedProgressBar(sNoInt, 5*7, 7, 15, 2); //*5 to address subsegments with hour
@@ -5286,7 +5726,7 @@ if (minuteGPS != oldMinute) {  // only update once per minute in order to avoid
 
 
 // day of year
-    int doy = calculateDayOfYear(day(localTime), month(localTime), year(localTime));
+    int doy = moment.dayOfYear;  // 17.10.2026: was calculateDayOfYear(day(localTime), month(localTime), year(localTime))
     lcd.setCursor(0,3);lcd.print(F("Yr"));
     //gapLessBar(doy, 365, 2, 15, 3);      //  yearly progress
     framedProgressBar(doy, 365, 2, 15, 3);
@@ -5294,7 +5734,6 @@ if (minuteGPS != oldMinute) {  // only update once per minute in order to avoid
     PrintFixedWidth(lcd, doy, 3);
   // https://gist.github.com/jrleeman/3b7c10712112e49d8607
   }
- oldMinute = minuteGPS;
 }
 
 //%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
@@ -0,0 +1,127 @@
+/*
+Automatic detection of the baud rate of the GPS receiver     // new 17.10.2026
+
+With a wrong baudRateNumber the clock never syncs. Therefore, when no sentence (or UBX message) with a valid
+checksum has arrived for AUTOBAUD_SILENT seconds, all rates of gpsBaud1[] in clock_hardware.h are tried in the
+background, AUTOBAUD_WINDOW seconds each. The score of a rate is the no of valid checksums in its window, from
+gps.passedChecksum() or ubx.passedChecksum. The best one is used and saved in EEPROM as baudRateNumber,
+and the configuration of clock_gpsconfig.h is sent again.
+If no rate gives valid data, e.g. without a GPS, the saved rate is used again, and the next scan is after
+AUTOBAUD_RETRY seconds.
+
+AutobaudSecond() is called once per second from GPSParse(). Not used with FEATURE_FAKE_SERIAL_GPS_IN or
+FEATURE_NMEA_REPLAY.
+
+AutobaudValid
+AutobaudBegin
+AutobaudSet
+AutobaudSecond
+*/
+
+#define AUTOBAUD_SILENT  5   // s without valid data before a scan
+#define AUTOBAUD_WINDOW  2   // s per baud rate, NMEA comes once per second
+#define AUTOBAUD_RETRY  60   // s before next scan when no rate had valid data
+
+#define AUTOBAUD_LOCKED  0   // at baudRateNumber
+#define AUTOBAUD_SCAN    1   // trying autobaudTry
+
+#define NO_OF_BAUD_RATES int(sizeof(gpsBaud1) / sizeof(gpsBaud1[0]))
+
+void EEPROMMyupdate(int address, byte val, byte commit);  // forward declaration, clock_helper_routines.h
+
+byte autobaudState = AUTOBAUD_LOCKED;
+byte autobaudSeconds = 0;        // without valid data (locked), or at this rate (scan)
+uint16_t autobaudWait = 0;       // s before a new scan may start
+int8_t autobaudTry;              // index of gpsBaud1[] being tried
+int8_t autobaudBest;             // best one so far, -1 = none
+uint16_t autobaudScore;          // valid checksums at autobaudTry
+uint16_t autobaudBestScore;
+uint32_t autobaudLastValid;      // AutobaudValid() at last AutobaudSecond()
+
+////////////////////////////////////////////////////////////////////////////////
+uint32_t AutobaudValid()  // no of sentences or messages with valid checksum so far
+{
+  return (gpsProtocol == PROTOCOL_UBX) ? ubx.passedChecksum : gps.passedChecksum();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void AutobaudBegin(int8_t number)  // Serial1 at rate gpsBaud1[number]
+{
+#if !defined(FEATURE_FAKE_SERIAL_GPS_IN) && !defined(FEATURE_NMEA_REPLAY)
+  Serial1.end();
+  gpsBaud = gpsBaud1[number];
+  Serial1.begin(gpsBaud);
+#endif
+  autobaudSeconds = 0;
+  autobaudScore = 0;
+  autobaudLastValid = AutobaudValid();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void AutobaudSet(int8_t number)  // rate chosen in secondary menu, stops a scan
+{
+  autobaudState = AUTOBAUD_LOCKED;
+  autobaudWait = 0;
+  AutobaudBegin(number);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void AutobaudSecond()  // once per second
+{
+#if !defined(FEATURE_FAKE_SERIAL_GPS_IN) && !defined(FEATURE_NMEA_REPLAY)
+  uint32_t valid = AutobaudValid();
+  uint16_t score = valid - autobaudLastValid;
+  autobaudLastValid = valid;
+
+  if (autobaudState == AUTOBAUD_LOCKED)
+  {
+    if (score > 0)
+    {
+      autobaudSeconds = 0;
+      autobaudWait = 0;
+      return;
+    }
+    if (autobaudWait > 0)
+    {
+      autobaudWait--;
+      return;
+    }
+    if (++autobaudSeconds < AUTOBAUD_SILENT) return;
+
+    autobaudState = AUTOBAUD_SCAN;  // start with the first rate
+    autobaudTry = 0;
+    autobaudBest = -1;
+    autobaudBestScore = 0;
+    AutobaudBegin(autobaudTry);
+    return;
+  }
+
+  // AUTOBAUD_SCAN:
+  autobaudScore += score;
+  if (++autobaudSeconds < AUTOBAUD_WINDOW) return;
+  if (autobaudScore > autobaudBestScore)
+  {
+    autobaudBest = autobaudTry;
+    autobaudBestScore = autobaudScore;
+  }
+  if (++autobaudTry < NO_OF_BAUD_RATES)  // next rate
+  {
+    AutobaudBegin(autobaudTry);
+    return;
+  }
+
+  autobaudState = AUTOBAUD_LOCKED;
+  if (autobaudBest < 0)  // nothing at any rate: back to the saved one
+  {
+    AutobaudBegin(baudRateNumber);
+    autobaudWait = AUTOBAUD_RETRY;
+    return;
+  }
+  baudRateNumber = autobaudBest;
+  EEPROMMyupdate(EEPROM_OFFSET1 + 5, baudRateNumber, 1);
+  AutobaudBegin(baudRateNumber);
+  gpsConfigLevel = GPS_CONFIG_NONE;  // configuration is sent again by GpsConfigCheck()
+#endif
+}
+
+/// THE END ///
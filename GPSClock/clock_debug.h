@@ -16,6 +16,10 @@
 //#define FEATURE_SERIAL_NEXTEVENTS  // debug NextEvent()
 //#define FEATURE_FACTORIZATION        // ScreenFactorization clock debug
 //#define FEATURE_BEATS               // Debug Swatch Internet Time 
+//#define FEATURE_SERIAL_TASKS        // run-time statistics of scheduler tasks, every 10 sec
+//#define FEATURE_PERF                // execution time histograms per task and screen: ScreenPerf + serial dump on 'p'. ~1.4 kB RAM
+//#define FEATURE_SERIAL_PPS          // interval, frequency error, jitter of each PPS pulse, clock_pps.h
+//#define FEATURE_SERIAL_FRAMES       // LCD content as text on serial port every second, for comparing screens on a PC
 
 // In LocalUTC(), WordClockNorwegian(), LcdSolarRiseSet(), ISOHebIslam():
 //#define FEATURE_DATE_PER_SECOND   // for stepping date/hour/min (86400/3600/60 sec step) quickly and check calender function (local time only)
@@ -66,3 +70,7 @@
 // Switches GPS input from Serial1 to Serial to fake missing GPS coverage for demo purposes:
 // Ex: enter this in appropriate COMx window of Arduino GUI at 9600 baud:
 // $GPRMC,192447.781,A,5950.292010,N,01025.680006,E,0.0,17.4,010222,,,*12
+
+//#define FEATURE_NMEA_REPLAY  // GPS data from log in clock_replay.h instead of Serial1, snapshots on serial port (115200 bps)
+#define REPLAY_SPEED 10        // 1 = real time, N = N times faster, 0 = as fast as possible
+// Not together with FEATURE_FAKE_SERIAL_GPS_IN. The PPS pulse is faked by calling ppsHandler()
@@ -78,7 +78,48 @@
 #define ScreenLocalMonth        49
 #define ScreenFactorization     50
 
+// new in v2.5.0
+#define ScreenPerf              51  // with FEATURE_PERF in clock_debug.h
+#define ScreenGPSLink           52
+#define ScreenPPS               53
+#define ScreenHoldover          54
+
 // New in v1.3.0:
-#define ScreenDemoClock         51  // must be the last one
+#define ScreenDemoClock         55  // must be the last one
+
+
+
+// new 17.10.2026: gpsProtocol, from "b. GPS protocol" in secondary setup menu
+#define PROTOCOL_NMEA 0         // NMEA text, TinyGPS++ and clock_nmea.h
+#define PROTOCOL_UBX  1         // u-blox binary, clock_ubx.h
+
+// new 17.10.2026: Properties of each screen in screens[] in GPSClock.ino, see ScreenSelect()
+#define NO_SCREEN 255           // menuScreen[] for position not in menu
+
+// refresh: when parts of the screen change, bits may be combined. The screen is only called when
+// one of them is due, and checks RefreshDue() for each part. All are due after InvalidateScreen()
+#define REFRESH_SECOND  0x01
+#define REFRESH_10S     0x02    // now() passes a multiple of 10 s
+#define REFRESH_MINUTE  0x04
+#define REFRESH_DAY     0x08    // local date changes
+#define REFRESH_FIRST   0x10    // first update after InvalidateScreen(), not used in screens[]
+#define REFRESH_ALL     0x1F
+
+// glyphs: custom character sets loaded by the screen, bits may be combined
+#define GLYPHS_ARROWS      0x01 // loadArrowCharacters()
+#define GLYPHS_NATIVE      0x02 // loadNativeCharacters()
+#define GLYPHS_BARS        0x04 // loadSimpleBarCharacters()
+#define GLYPHS_3WIDE       0x08 // loadThreeWideDigits()
+#define GLYPHS_3HIGH       0x10 // loadThreeHighDigits2()
+#define GLYPHS_GAPLESS     0x20 // loadGapLessCharacters7A()
+#define GLYPHS_FRAMEDBARS  0x40 // loadCurvedFramedBarCharactersA()
+#define GLYPHS_ARING       0x80 // loadAring()
 
+// flags:
+#define SCREEN_NEEDS_FIX   0x01 // position from GPS needed, skipped in demo mode without it
+#define SCREEN_DEMO        0x02 // DemoClock(), argument is 0 when demo is running
 
+// cost: estimated time to draw the screen on the Mega
+#define COST_LOW     0          // < 5 ms
+#define COST_MEDIUM  1          // < 50 ms
+#define COST_HIGH    2          // longer, e.g. moon rise/set, Hebrew calendar, eclipses
@@ -0,0 +1,160 @@
+/*
+Configuration of the GPS receiver: only the messages which are needed     // new 17.10.2026
+
+Most receivers send RMC, GGA, GSA, GSV, GLL, VTG and more every second, for several talkers, and readGPS()
+has to read all of it. Here the receiver is told which messages to send, with PMTK314 for MediaTek chips
+(GPS_CONFIG_MTK in clock_hardware.h, e.g. QRPLabs QLG1, QLG2) and UBX-CFG-MSG for u-blox (GPS_CONFIG_UBLOX,
+e.g. NEO-6M, NEO-M8). Neither is defined by default: only the one for the receiver in use should be, as
+the commands of the other make would be sent to it at boot and on each change of level.
+Needs the TX line from the Arduino to RX of the GPS (Serial1: pin 18 on the Mega).
+
+Levels, from the screens in the menu and the one shown:
+  GPS_CONFIG_TIME        RMC, GGA only: time, date, position, satellites in fix, hdop
+  GPS_CONFIG_SATS_SLOW   + GSA every second, GSV every 5th: GPSInfo() is in the menu, but not shown.
+                           sats[] is then kept up to date, as SAT_TIMEOUT is 10 s
+  GPS_CONFIG_SATS        + GSV every second: GPSInfo() is shown, also in demo mode
+
+With UBX protocol (clock_ubx.h): NMEA off, NAV-PVT and TIM-TP every second, NAV-SAT as GSV above.
+
+GpsConfigure() is called by setup(), GpsConfigCheck() by GPSParse() once per second, which sends a new
+configuration when the level changes, e.g. on entering ScreenGPSInfo or after choosing another subset of screens.
+The settings are not saved in the receiver, so it is back to its defaults after power off.
+
+GpsSetBaud() tells the receiver to change its baud rate (PMTK251, UBX-CFG-PRT), when it is changed in the
+secondary setup menu.
+
+GpsSendNmea
+GpsSendUbx
+GpsSendUbxMsgRate
+GpsConfigWanted
+GpsConfigure
+GpsSetBaud
+GpsConfigCheck
+*/
+
+#define GPS_CONFIG_NONE      255  // nothing sent yet
+#define GPS_CONFIG_TIME      0
+#define GPS_CONFIG_SATS_SLOW 1
+#define GPS_CONFIG_SATS      2
+
+#define GPS_CONFIG_SLOW_RATE 5    // GSV, NAV-SAT every 5th second
+
+byte gpsConfigLevel = GPS_CONFIG_NONE;     // sent to receiver
+byte gpsConfigProtocol = PROTOCOL_NMEA;    // gpsProtocol when it was sent
+
+#if !defined(FEATURE_FAKE_SERIAL_GPS_IN) && !defined(FEATURE_NMEA_REPLAY)  // i.e. GPS is on Serial1
+
+////////////////////////////////////////////////////////////////////////////////
+void GpsSendNmea(const char *body)  // "$" + body + "*" + checksum + CR LF
+{
+  byte sum = 0;
+  for (const char *p = body; *p != 0; p++) sum ^= *p;
+  Serial1.print('$');
+  Serial1.print(body);
+  Serial1.print('*');
+  if (sum < 0x10) Serial1.print('0');
+  Serial1.print(sum, HEX);
+  Serial1.print(F("\r\n"));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void GpsSendUbx(byte msgClass, byte msgId, const byte *payload, byte length)  // sync, header, payload, checksum
+{
+  byte header[] = {UBX_SYNC1, UBX_SYNC2, msgClass, msgId, length, 0};
+  byte ckA = 0, ckB = 0;
+  for (byte i = 2; i < sizeof(header); i++)
+  {
+    ckA += header[i];
+    ckB += ckA;
+  }
+  for (byte i = 0; i < length; i++)
+  {
+    ckA += payload[i];
+    ckB += ckA;
+  }
+  Serial1.write(header, sizeof(header));
+  Serial1.write(payload, length);
+  Serial1.write(ckA);
+  Serial1.write(ckB);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void GpsSendUbxMsgRate(byte msgClass, byte msgId, byte rate)  // UBX-CFG-MSG, rate on the port it comes in on
+{
+  byte payload[] = {msgClass, msgId, rate};
+  GpsSendUbx(0x06, 0x01, payload, sizeof(payload));
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+byte GpsConfigWanted()  // level for menu subset and screen shown
+{
+  if (menuOrder[ScreenGPSInfo] >= noOfStates) return GPS_CONFIG_TIME;  // not in menu
+  int shown = dispState;
+  if (dispState == menuOrder[ScreenDemoClock]) shown = demoDispState;
+  if (shown >= 0 && shown < noOfScreens && menuScreen[shown] == ScreenGPSInfo) return GPS_CONFIG_SATS;
+  return GPS_CONFIG_SATS_SLOW;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void GpsConfigure(byte level)  // send configuration to receiver
+{
+  gpsConfigLevel = level;
+  gpsConfigProtocol = gpsProtocol;
+#if !defined(FEATURE_FAKE_SERIAL_GPS_IN) && !defined(FEATURE_NMEA_REPLAY) && (defined(GPS_CONFIG_MTK) || defined(GPS_CONFIG_UBLOX))
+  byte gsa = (level == GPS_CONFIG_TIME) ? 0 : 1;
+  byte gsv = (level == GPS_CONFIG_SATS) ? 1 : (level == GPS_CONFIG_SATS_SLOW) ? GPS_CONFIG_SLOW_RATE : 0;
+
+#ifdef GPS_CONFIG_MTK
+  // PMTK314: output every n fixes of GLL, RMC, VTG, GGA, GSA, GSV, 13 reserved/unused, 0 = off
+  char body[50];
+  sprintf(body, "PMTK314,0,1,0,1,%u,%u,0,0,0,0,0,0,0,0,0,0,0,0,0", gsa, gsv);
+  GpsSendNmea(body);
+#endif
+
+#ifdef GPS_CONFIG_UBLOX
+  // UBX-CFG-MSG: NMEA standard messages are class 0xF0: 0 GGA, 1 GLL, 2 GSA, 3 GSV, 4 RMC, 5 VTG, 8 ZDA, 0x0D GNS
+  bool nmeaOn = (gpsProtocol != PROTOCOL_UBX);
+  GpsSendUbxMsgRate(0xF0, 0x00, nmeaOn);        // GGA
+  GpsSendUbxMsgRate(0xF0, 0x04, nmeaOn);        // RMC
+  GpsSendUbxMsgRate(0xF0, 0x02, nmeaOn ? gsa : 0);  // GSA
+  GpsSendUbxMsgRate(0xF0, 0x03, nmeaOn ? gsv : 0);  // GSV
+  GpsSendUbxMsgRate(0xF0, 0x01, 0);             // GLL
+  GpsSendUbxMsgRate(0xF0, 0x05, 0);             // VTG
+  GpsSendUbxMsgRate(0xF0, 0x08, 0);             // ZDA
+  GpsSendUbxMsgRate(0xF0, 0x0D, 0);             // GNS
+  GpsSendUbxMsgRate(UBX_NAV_PVT >> 8, UBX_NAV_PVT & 0xFF, !nmeaOn);
+  GpsSendUbxMsgRate(UBX_NAV_SAT >> 8, UBX_NAV_SAT & 0xFF, nmeaOn ? 0 : gsv);
+  GpsSendUbxMsgRate(UBX_TIM_TP >> 8,  UBX_TIM_TP & 0xFF,  !nmeaOn);
+#endif
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void GpsSetBaud(uint32_t baud)  // tell receiver to change baud rate, before Serial1 changes
+{
+#if !defined(FEATURE_FAKE_SERIAL_GPS_IN) && !defined(FEATURE_NMEA_REPLAY)
+#ifdef GPS_CONFIG_MTK
+  char body[20];
+  sprintf(body, "PMTK251,%lu", (unsigned long)baud);
+  GpsSendNmea(body);
+#endif
+#ifdef GPS_CONFIG_UBLOX
+  // UBX-CFG-PRT for UART1: 8N1, in: UBX + NMEA + RTCM, out: UBX + NMEA
+  byte payload[20] = {1, 0, 0, 0, 0xD0, 0x08, 0, 0,
+                      (byte)baud, (byte)(baud >> 8), (byte)(baud >> 16), (byte)(baud >> 24),
+                      0x07, 0, 0x03, 0, 0, 0, 0, 0};
+  GpsSendUbx(0x06, 0x00, payload, sizeof(payload));
+#endif
+  Serial1.flush();  // before Serial1.end()
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void GpsConfigCheck()  // once per second, from GPSParse(): new configuration if screens or protocol have changed
+{
+  byte level = GpsConfigWanted();
+  if (level != gpsConfigLevel || gpsProtocol != gpsConfigProtocol) GpsConfigure(level);
+}
+
+/// THE END ///
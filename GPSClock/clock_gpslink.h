@@ -0,0 +1,147 @@
+/*
+Health of the serial link from the GPS receiver, shown on ScreenGPSLink        // new 17.10.2026
+
+readGPS() empties the RX buffer of the serial port. If it is not called often enough, e.g. during
+a slow screen, the buffer fills up and characters are lost without any notice. Measured here:
+
+  bytes/s and sentences/s per type, counted by LinkByte() and LinkSentence() in readGPS(), NmeaEncode()
+  RX buffer high-water mark, from available() when readGPS() starts, and no of times the buffer was full
+  longest time between two calls of readGPS(), and the screen which was shown then. If it is longer
+    than the time it takes to fill the RX buffer at the baud rate of the GPS, characters may be lost
+  sentences cut off by the next '$', i.e. characters have been lost
+  checksum failures, from gps.failedChecksum() of TinyGPS++, or ubx.failedChecksum with UBX
+  gaps: no characters from the GPS for LINK_GAP ms or more
+
+Rates are for the last second, high-water marks and longest wait are for the last LINK_WINDOW seconds,
+and the error counts are totals since start.
+
+LinkByte
+LinkSentence
+LinkRead
+LinkFillMs
+LinkSecond
+LinkRxMax
+LinkWaitMax
+*/
+
+// RX buffer of the serial port, in the core of the board
+#if defined(SERIAL_RX_BUFFER_SIZE)      // AVR
+  #define LINK_RX_BUFFER SERIAL_RX_BUFFER_SIZE
+#elif defined(SERIAL_BUFFER_SIZE)       // SAMD
+  #define LINK_RX_BUFFER SERIAL_BUFFER_SIZE
+#else
+  #define LINK_RX_BUFFER 64
+#endif
+
+#define LINK_GAP    2000  // ms without characters from GPS, NMEA comes at least once per second
+#define LINK_WINDOW 10    // s, for high-water mark and longest wait
+
+#define LINK_TYPES 9      // sentence types counted, last one is all others
+const char linkTypeName[LINK_TYPES][4] = {"RMC", "GGA", "GSA", "GSV", "GLL", "VTG", "ZDA", "TXT", "oth"};
+
+struct
+{
+  uint16_t bytes;                    // this second
+  uint16_t bytesPerSec;              // last second
+  byte sentences[LINK_TYPES];        // this second
+  byte sentencesPerSec[LINK_TYPES];  // last second
+  bool inSentence;                   // '$' received, but not the end of line
+  uint16_t cut;                      // sentences cut off by '$' of next one
+  uint16_t full;                     // RX buffer was full
+  uint16_t gaps;                     // no characters for LINK_GAP ms
+  uint32_t lastByte;                 // millis() when last characters were read
+  uint32_t lastRead;                 // millis() when readGPS() last started
+  uint16_t rxMax, rxMaxLast;         // max bytes waiting in RX buffer, this and last window
+  uint16_t waitMax, waitMaxLast;     // ms, longest time between calls of readGPS(), this and last window
+  byte waitScreen, waitScreenLast;   // screen no when waitMax happened
+  byte window;                       // seconds into this window
+} gpsLink;
+
+////////////////////////////////////////////////////////////////////////////////
+void LinkByte(char c)  // each character from GPS
+{
+  gpsLink.bytes++;
+  if (gpsProtocol == PROTOCOL_UBX) return;  // binary, '$' may be data
+  if (c == '$')
+  {
+    if (gpsLink.inSentence) gpsLink.cut++;
+    gpsLink.inSentence = true;
+  }
+  else if (c == '\n') gpsLink.inSentence = false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LinkSentence(const char *id, byte length)  // talker + sentence ID, e.g. "GPGSV", from NmeaEndField()
+{
+  byte type = 0;
+  if (length == 5)
+    while (type < LINK_TYPES - 1 && strncmp(&id[2], linkTypeName[type], 3) != 0) type++;
+  else type = LINK_TYPES - 1;  // e.g. $PUBX, $PMTK
+  if (gpsLink.sentences[type] < 255) gpsLink.sentences[type]++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LinkRead(int waiting)  // when readGPS() starts, waiting = available()
+{
+  uint32_t nowMillis = millis();
+  uint16_t wait = (nowMillis - gpsLink.lastRead > 0xFFFF) ? 0xFFFF : nowMillis - gpsLink.lastRead;
+  gpsLink.lastRead = nowMillis;
+
+  if (wait > gpsLink.waitMax)
+  {
+    gpsLink.waitMax = wait;
+    int shown = dispState;
+    if (dispState == menuOrder[ScreenDemoClock]) shown = demoDispState;  // screen shown in demo mode, as in GpsConfigWanted()
+    gpsLink.waitScreen = (shown >= 0 && shown < noOfScreens) ? menuScreen[shown] : NO_SCREEN;
+  }
+  if (waiting == 0) return;
+
+  if ((uint16_t)waiting > gpsLink.rxMax) gpsLink.rxMax = waiting;
+  if (waiting >= LINK_RX_BUFFER - 1) gpsLink.full++;  // AVR ring buffer holds one less than its size
+  if (nowMillis - gpsLink.lastByte >= LINK_GAP && gpsLink.lastByte != 0) gpsLink.gaps++;
+  gpsLink.lastByte = nowMillis;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t LinkFillMs()  // time it takes to fill the RX buffer, 10 bits per character
+{
+  if (gpsBaud == 0) return 0xFFFF;
+  return (10000UL * LINK_RX_BUFFER) / gpsBaud;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LinkSecond()  // once per second, from GPSParse()
+{
+  gpsLink.bytesPerSec = gpsLink.bytes;
+  gpsLink.bytes = 0;
+  memcpy(gpsLink.sentencesPerSec, gpsLink.sentences, LINK_TYPES);
+  memset(gpsLink.sentences, 0, LINK_TYPES);
+
+  if (++gpsLink.window < LINK_WINDOW) return;
+  gpsLink.window = 0;
+  gpsLink.rxMaxLast = gpsLink.rxMax;
+  gpsLink.waitMaxLast = gpsLink.waitMax;
+  gpsLink.waitScreenLast = gpsLink.waitScreen;
+  gpsLink.rxMax = 0;
+  gpsLink.waitMax = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t LinkRxMax()  // bytes, max of this and last window
+{
+  return max(gpsLink.rxMax, gpsLink.rxMaxLast);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t LinkWaitMax(byte &screen)  // ms, max of this and last window, and screen no when it happened
+{
+  if (gpsLink.waitMax >= gpsLink.waitMaxLast)
+  {
+    screen = gpsLink.waitScreen;
+    return gpsLink.waitMax;
+  }
+  screen = gpsLink.waitScreenLast;
+  return gpsLink.waitMaxLast;
+}
+
+/// THE END ///
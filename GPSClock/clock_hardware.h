@@ -66,8 +66,17 @@
   4800; // OK for EM-406A and ADS-GM1
   9600; // OK for QLG1, QRPLabs
 */
-// set of baud rates to choose from for GPS input:
-static const uint32_t gpsBaud1[] = {4800, 9600, 19200};
+// set of baud rates to choose from for GPS input, also found automatically, see clock_autobaud.h:
+// 17.10.2026: the 64 byte receive buffer of Serial1 is full after 17 ms at 38400, 11 ms at 57600, 5.5 ms at 115200 baud.
+// readGPS is not pre-emptive: a long screen only lets it run where it calls TaskYield(), see clock_scheduler.h.
+// Bytes lost when it comes too late are counted as "cut" in clock_gpslink.h, ScreenGPSLink
+static const uint32_t gpsBaud1[] = {4800, 9600, 19200, 38400, 57600, 115200};
+
+// Configuration of GPS receiver at start-up, only the messages which are needed, see clock_gpsconfig.h
+// Choose the one for the receiver in use, or none: then nothing is sent and the receiver keeps its defaults. 
+// Needs TX line from Arduino to GPS. UBX protocol (secondary menu) needs GPS_CONFIG_UBLOX, as NAV-PVT is not on by default
+//#define GPS_CONFIG_MTK      // PMTK commands for MediaTek chips, e.g. QLG1, QLG2 from QRPLabs
+//#define GPS_CONFIG_UBLOX    // UBX-CFG-MSG for u-blox, e.g. NEO-6M, NEO-M8
 
 //lcd pins
 #if defined(FEATURE_LCD_4BIT) 
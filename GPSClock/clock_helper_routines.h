@@ -46,8 +46,22 @@ readIntFromEEPROM
 updateIntIntoEEPROM
 resetFunc
 InitScreenSelect
-RotarySecondarySetup
+MenuClose
+MenuTimeOut
+MenuConfirmDone
+MenuConfirm
+ShowMenuTop
+ShowSecondaryTop
+ShowSetupItem
+EnterSetupItem
+RotateSetupItem
+SaveSetupItem
+ShowSecondaryItem
+EnterSecondaryItem
+RotateSecondaryItem
+SaveSecondaryItem
 RotarySetup
+RotarySetupStep
 
 GPSParse
 
@@ -82,6 +96,9 @@ print_factors
 void CodeStatus(void);        // forward declaration
 void Progress(void);          // forward declaration
 void DemoClock(byte inDemo);  // forward declaration
+void InvalidateScreen(void);  // forward declaration
+void ScreenChanged(void);     // forward declaration
+bool RefreshDue(byte refresh);  // forward declaration
 
 void EEPROMMyupdate(int address, byte val, byte commit) // replaces EEPROM.update as it won't work for Metro
 { 
@@ -119,7 +136,7 @@ void GetNextRiseSet(
 
  // local = 1638052000; // 27.11.2021, ~23.30
   
-  pLocal = 100 * hour(localTime) + minute(localTime);
+  pLocal = 100 * moment.localTm.Hour + moment.localTm.Minute;
 
 #ifdef FEATURE_SERIAL_MOON
   //  Serial.print(F("zone "));Serial.println(zone);
@@ -329,8 +346,10 @@ void UpdateMoonPosition() {
 
   double RA, Dec, topRA, topDec, LST, HA;
 
+  PositionGet();  // 17.10.2026: was latitude, lon of last screen which read them
+
   // UTC time:
-  moon2(year(now()), month(now()), day(now()), (hour(now()) + (minute(now()) / 60.0) + (second(now()) / 3600.0)), lon, latitude, &RA, &Dec, &topRA, &topDec, &LST, &HA, &moon_azimuth, &moon_elevation, &moon_dist);
+  moon2(tmYearToCalendar(moment.utcTm.Year), moment.utcTm.Month, moment.utcTm.Day, (moment.utcTm.Hour + (moment.utcTm.Minute / 60.0) + (moment.utcTm.Second / 3600.0)), lon, latitude, &RA, &Dec, &topRA, &topDec, &LST, &HA, &moon_azimuth, &moon_elevation, &moon_dist);
 
 #ifdef FEATURE_SERIAL_MOON
   Serial.print(F("moon2: "));
@@ -537,24 +556,17 @@ void LcdUTCTimeLocator(int lineno, int col=0)
 
 //  if (gps.time.isValid()) {
     lcd.setCursor(min(max(col,0),1), lineno);
-    sprintf(textBuffer, "%02d%c%02d%c%02d UTC ", hour(now()), dateTimeFormat[dateFormat].hourSep, minute(now()), dateTimeFormat[dateFormat].minSep, second(now()));
+    sprintf(textBuffer, "%02d%c%02d%c%02d UTC ", moment.utcTm.Hour, dateTimeFormat[dateFormat].hourSep, moment.utcTm.Minute, dateTimeFormat[dateFormat].minSep, moment.utcTm.Second);
     lcd.print(textBuffer);
 //  }
 
-  if (gps.satellites.isValid()) {
-
-#ifndef DEBUG_MANUAL_POSITION
-    latitude = gps.location.lat();
-    lon = gps.location.lng();
-#else
-    latitude = latitude_manual;
-    lon      = longitude_manual;
-#endif
+  if (gnss.satellites.isValid()) {
 
-//    char locator[7];
-    Maidenhead(lon, latitude, textBuffer);
+    static char locator[7];          // 17.10.2026: only computed when position.version changes, clock_position.h
+    static uint16_t locatorVersion = 0;
+    if (PositionChanged(locatorVersion)) Maidenhead(position.lon, position.lat, locator);
     lcd.setCursor(14, lineno);
-    lcd.print(textBuffer);
+    lcd.print(locator);
   }
 }
 
@@ -633,14 +645,14 @@ void LcdShortDayDateTimeLocal(int lineno = 0, int moveLeft = 0) {
   //  "Wed 20.10     22:30:46" - date separator in fixed location, even if date is ' 9.8'
   // get local time
   localTime = now() + utcOffset * 60;
-  Hour = hour(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Hour = moment.localTm.Hour;
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
   
   // local date
-  Day = day(localTime);
-  Month = month(localTime);
-  Year = year(localTime);
+  Day = moment.localTm.Day;
+  Month = moment.localTm.Month;
+  Year = tmYearToCalendar(moment.localTm.Year);
     
   lcd.setCursor(0, lineno);
   if (dayGPS != 0)
@@ -690,13 +702,13 @@ void LcdTimeLocalShortDayDate(int lineno = 0, int moveRight = 0) {  // unused as
   // get local time
   localTime = now() + utcOffset * 60;
 
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
-    if (Twelve24Local > 12) Hour = hour(localTime);
+    if (Twelve24Local > 12) Hour = moment.localTm.Hour;
     else  {
       Hour = hourFormat12(localTime);
-      if (oldMinute == -1 || 
+      if (RefreshDue(REFRESH_FIRST) || 
         ( (Hour==0 || Hour == 12) && Minute == 00 && Seconds == 0) ) {   // load am/pm symbol as seldom as possible into lcd
         if (isAM(localTime)) {
           memcpy_P(buffer, am, 8);                 // am symbol (clashes with Norse, Faroese char set)
@@ -717,9 +729,9 @@ void LcdTimeLocalShortDayDate(int lineno = 0, int moveRight = 0) {  // unused as
 
   
   // local date
-  Day = day(localTime);
-  Month = month(localTime);
-  Year = year(localTime);
+  Day = moment.localTm.Day;
+  Month = moment.localTm.Month;
+  Year = tmYearToCalendar(moment.localTm.Year);
     
   lcd.setCursor(moveRight, lineno);
   if (dayGPS != 0)
@@ -787,53 +799,39 @@ void LcdSolarRiseSet(
   // 19.02.2024 Rewritten from https://github.com/chaeplin/Sunrise to https://github.com/jpb10/SolarCalculator
   //            Sunrise library is obsolete, won't compile for Metro Express without a fix, and also inaccurate
  
-  double transit, sunrise, sunset;  // time in utc hours of events  
+  // 17.10.2026: rise, set and noon from solar[] of clock_solar.h, computed once per day instead of on every call
   int m, hr, mn;                    // time in hr, mn local time
-  tmElements_t tm_riseSet;
-  time_t riseSetTime;
-
-  int yr;
-  uint8_t mth, dy;
 
-  // 22.08.2025: yr, mnth, dy replaced yearGPS, monthGPS, dayGPS
-  yr = year();
-  mth = month();
-  dy = day();
-  
-  #ifdef FEATURE_DATE_PER_SECOND  // for stepping date quickly and check calender function   
-    // check June when sun hardly sets
-    //mth = 6;
-    dy =  dateIteration;
-    dateIteration = dateIteration + 1;
+  #ifdef FEATURE_DATE_PER_SECOND  // for stepping date quickly and check calender function, local date is stepped in MomentFill()
+    solarDay_type *solarDay = SolarGet(moment.local);
+  #else
+    solarDay_type *solarDay = SolarGet(now());  // UTC date, as year(), month(), day() before
   #endif
+
   // https://www.timeanddate.com/astronomy/different-types-twilight.html
+  byte horizon = SOLAR_ACTUAL;      // also for O, Z, W
   if (RiseSetDefinition == 'A')     // astronomical: -18 deg
   // "During astronomical twilight, most celestial objects can be observed in the sky. However, the atmosphere still scatters and 
   // refracts a small amount of sunlight, and that may make it difficult for astronomers to view the faintest objects."
   // Astronomisk tussmørke
-        calcAstronomicalDawnDusk(yr, mth, dy, latitude, lon, transit, sunrise, sunset);
+        horizon = SOLAR_ASTRONOMICAL;
         
   else if (RiseSetDefinition == 'N') // Nautical:     -12 deg
   // "nautical twilight, dates back to the time when sailors used the stars to navigate the seas. 
   // During this time, most stars can be easily seen with naked eyes, and the horizon is usually also visible in clear weather conditions."
   // Nautisk tussmørke
-        calcNauticalDawnDusk(yr, mth, dy, latitude, lon, transit, sunrise, sunset);
+        horizon = SOLAR_NAUTICAL;
         
   else if (RiseSetDefinition == 'C') // Civil:        - 6 deg 
   // "enough natural sunlight during this period that artificial light may not be required to carry out outdoor activities."
   // Alminnelig tussmørke	
-        calcCivilDawnDusk(yr, mth, dy, latitude, lon, transit, sunrise, sunset);
-        
-  else  
-    //mySunrise.Actual();           // Actual          0 deg
-        calcSunriseSunset(yr, mth, dy, latitude, lon, transit, sunrise, sunset);  // time in hours
+        horizon = SOLAR_CIVIL;
 
   // (1) First: print sun rise time
-  //t = mySunrise.Rise(mth, dy,); // Sun rise hour minute
 
-  if (sunrise >= 0) {             // if not satisfied, then e.g. for 'N' then sun never dips below 18 deg at night, as in mid summer in Oslo
+  if (solarDay->rise[horizon] != SOLAR_NONE) {  // if not satisfied, then e.g. for 'N' then sun never dips below 18 deg at night, as in mid summer in Oslo
   
-    m = int(round(sunrise * 60 + utcOffset));
+    m = solarDay->rise[horizon];
     hr = (m / 60) % 24;
     mn = m % 60;
     
@@ -875,8 +873,8 @@ void LcdSolarRiseSet(
   else if (RiseSetDefinition == 'C')  lcd.write(DASHED_DOWN_ARROW);
   else                                lcd.print(" ");
 
-  if (sunset >= 0) {   
-    m = int(round(sunset * 60 + utcOffset));
+  if (solarDay->set[horizon] != SOLAR_NONE) {   
+    m = solarDay->set[horizon];
     hr = (m / 60) % 24;
     mn = m % 60;
 
@@ -905,39 +903,24 @@ void LcdSolarRiseSet(
 
   /////// Solar elevation //////////////////
 
-  double sun_azimuth = 0;
-  double sun_elevation = 0;
-  double sun_elevationTransit;
-
-  // solar az, el now:
-  calcHorizontalCoordinates(now(), latitude, lon, sun_azimuth, sun_elevation);
-
   if (RiseSetDefinition == 'Z') // print current aZimuth, elevation
     {
+      SolarNow();  // solar az, el now, once per second
       lcd.setCursor(0, lineno);
       lcd.print(F("nowEl "));              // added "now" 18.6.2023
-      PrintFixedWidth(lcd, (int)round(sun_elevation), 3);
+      PrintFixedWidth(lcd, (int)round(solarNow.elevation), 3);
       lcd.write(DEGREE);
       lcd.setCursor(11, lineno);
       lcd.print(F("Az "));
-      PrintFixedWidth(lcd, (int)round(sun_azimuth), 3);
+      PrintFixedWidth(lcd, (int)round(solarNow.azimuth), 3);
       lcd.write(DEGREE);
       lcd.print(F("  "));         
     }
 
-  ///// Solar noon in utc
-    m = int(round(transit * 60));
-    hr = (m / 60) % 24;
-    mn = m % 60;
- 
-  // find utc time of transit (unix time)
-  tmElements_t tm_transit= {0, (uint8_t)mn, (uint8_t)hr, (uint8_t)weekday(), (uint8_t)day(), (uint8_t)month(), (uint8_t)(year()-1970) };
-  time_t transitTime = makeTime(tm_transit);     
-  calcHorizontalCoordinates(transitTime, latitude, lon, sun_azimuth, sun_elevationTransit);
-
 ///// Solar noon in local time
-  if (transit >= 0) {  
-    m = int(round(transit * 60 + utcOffset));
+  hr = mn = 0;
+  if (solarDay->transit != SOLAR_NONE) {  
+    m = solarDay->transit;
     hr = (m / 60) % 24;
     mn = m % 60;
   }
@@ -949,12 +932,13 @@ void LcdSolarRiseSet(
  
     if (RiseSetDefinition == ' ')
     { 
-      PrintFixedWidth(lcd, (int)round(sun_elevation), 3);  // actual rise time
+      SolarNow();
+      PrintFixedWidth(lcd, (int)round(solarNow.elevation), 3);  // actual rise time
       lcd.write(DEGREE);
     }
     else if (RiseSetDefinition == 'C')
     {
-      if (sunset >= 0) 
+      if (solarDay->set[SOLAR_CIVIL] != SOLAR_NONE) 
       {
         if (hr < 10) lcd.setCursor(16, 2); // added 4.7.2016 to deal with summer far North
         lcd.print(hr, DEC);
@@ -966,7 +950,8 @@ void LcdSolarRiseSet(
     else if (RiseSetDefinition == 'N')          // 
     {
       // Noon data:
-      PrintFixedWidth(lcd, (int)round(sun_elevation), 3);
+      SolarNow();
+      PrintFixedWidth(lcd, (int)round(solarNow.elevation), 3);
       lcd.write(DEGREE);
     }  
   }      // if (ScreenMode == ...)
@@ -975,7 +960,7 @@ void LcdSolarRiseSet(
   {
     lcd.setCursor(0, lineno);
     lcd.print(F("maxEl "));         // added "max" 18.6.2023
-    PrintFixedWidth(lcd, (int)round(sun_elevationTransit), 3);
+    PrintFixedWidth(lcd, (int)round(solarDay->transitElevation), 3);
     lcd.write(DEGREE);              // added 27.04.2022
     lcd.print(" ");   
     lcd.setCursor(12, lineno);
@@ -987,20 +972,13 @@ void LcdSolarRiseSet(
 
   if (RiseSetDefinition == 'W') // Where is sun's azimuth at actual rise and set times 5.3.2025
    {
-// Done:   calcSunriseSunset(yr, mth, dy,, latitude, lon, transit, sunrise, sunset);  // time in hours
-// find utc time of sunrise/set (unix time)
-    tm_riseSet= {0, (uint8_t)mn, (uint8_t)sunrise, (uint8_t)weekday(), (uint8_t)day(), (uint8_t)month(), (uint8_t)(year()-1970) };
-    riseSetTime = makeTime(tm_riseSet);   
-    calcHorizontalCoordinates(riseSetTime, latitude, lon, sun_azimuth, sun_elevation);
+    // 17.10.2026: at the minute of rise and set, was the hour of rise/set with the minute of noon
     lcd.setCursor(0, lineno);  
     lcd.print(F("Az ")); lcd.write(UP_ARROW);
-    lcd.print(F("  "));PrintFixedWidth(lcd, (int)round(sun_azimuth), 3);lcd.write(DEGREE);lcd.print(" "); 
+    lcd.print(F("  "));PrintFixedWidth(lcd, (int)round(solarDay->riseAzimuth), 3);lcd.write(DEGREE);lcd.print(" "); 
     
-    tm_riseSet= {0, (uint8_t)mn, (uint8_t)sunset, (uint8_t)weekday(), (uint8_t)day(), (uint8_t)month(), (uint8_t)(year()-1970) };
-    riseSetTime = makeTime(tm_riseSet); 
-    calcHorizontalCoordinates(riseSetTime, latitude, lon, sun_azimuth, sun_elevation);
     lcd.setCursor(11, lineno);lcd.write(DOWN_ARROW);
-    lcd.print(F("  "));PrintFixedWidth(lcd, (int)round(sun_azimuth), 3);lcd.write(DEGREE);lcd.print(" "); 
+    lcd.print(F("  "));PrintFixedWidth(lcd, (int)round(solarDay->setAzimuth), 3);lcd.write(DEGREE);lcd.print(" "); 
    }  
 }
 
@@ -1523,773 +1501,528 @@ while ((menuStruct[subsetMenu].order[noOfStates] >= 0) && (noOfStates <= lengthO
   // initialize and unroll menu system order
   for (iiii = 0; iiii < int(sizeof(menuOrder)/sizeof(menuOrder[0])); iiii += 1) menuOrder[iiii] = -1; // fix 5.10.2022
   for (iiii = 0; iiii < noOfStates; iiii += 1) menuOrder[menuStruct[subsetMenu].order[iiii]] = iiii;
+
+  // 17.10.2026: and the inverse, used by ScreenSelect()
+  for (iiii = 0; iiii < noOfScreens; iiii += 1) menuScreen[iiii] = NO_SCREEN;
+  for (iiii = 0; iiii < noOfStates; iiii += 1) menuScreen[iiii] = menuStruct[subsetMenu].order[iiii];
 }
 
 //////////////////////////////////////////
 
+/////////////////// ROTARY -> SETUP PARAMETERS ///////////////////
+// 17.10.2026: Rewritten from blocking while() loops to a state machine which is advanced by checkEncoder() 
+// on every pass of loop(). GPS input and PPS sync keep running while the menu is open.
+// Time-out of menu (menuTimeOut) and confirmation screens are timer events, see StartTimer() in clock_scheduler.h
+
+#define MENU_OFF            0  // normal clock display
+#define MENU_TOP            1  // choose primary menu item,   menuNumber
+#define MENU_ITEM           2  // change value of menu item,  menuNumber
+#define MENU_SECONDARY      3  // choose secondary menu item, secondaryMenuNumber
+#define MENU_SECONDARY_ITEM 4  // change value of secondary menu item
+#define MENU_CONFIRM        5  // screen showing the changed parameter, for 1.5 sec
+
+byte menuState = MENU_OFF;
+int menuNumber = 0;
+const int maxMenuNumber = 6;         // for the 0-6 primary menu items
 int secondaryMenuNumber;
+const int noOfSecondaryMenuIn = 9;   // no of secondary menu items 7: 18.11.2024, 9: 17.10.2026
+int8_t oldBaudRateNumber;            // for detecting change of GPS baud rate
 
-void RotarySecondarySetup(){ // June 2023
-// menu system for secondary menu
-  uint32_t startTime; // for time-out out of menu
-  int toggleInternRotary = 0;
-
-  lcd.setCursor(0,2);
-  //lcd.print(secondaryMenuNumber);lcd.print(" "); // removed 22.11.2024
+void MenuTimeOut(void);  // forward declaration
 
-  #ifdef FEATURE_SERIAL_MENU
-      Serial.print(F("2ndary # ")); Serial.println(secondaryMenuNumber);
-  #endif
-  
-  switch (secondaryMenuNumber) {
+//////////////////////////////////////////
+void MenuClose()  // back to normal clock display
+{
+  StopTimer(MenuTimeOut);
+  menuState = MENU_OFF;
+  InvalidateScreen();  // to get immediate display of some info
+  ScreenChanged();     // redraw clock face immediately
+}
 
-case 0: // GPS baud rate //////////////
- {
-  baudRateNumber = EEPROM.read(EEPROM_OFFSET1+5); 
-  #ifdef FEATURE_SERIAL_MENU
-      Serial.print(F("baudRateNumber ")); Serial.println(baudRateNumber);
-  #endif
-  int8_t oldBaudRateNumber = baudRateNumber;
-  
-  int noOfMenuIn = sizeof(gpsBaud1)/sizeof(gpsBaud1[1]); 
-  #ifdef FEATURE_SERIAL_MENU
-      Serial.print(F("noOfMenuIn ")); Serial.println(noOfMenuIn);
-      Serial.println(gpsBaud1[baudRateNumber]);
-  #endif
-  lcd.setCursor(0,2); PrintFixedWidth(lcd,baudRateNumber, 2); lcd.print(" "); PrintFixedWidth(lcd, gpsBaud1[baudRateNumber], 6);
-  startTime = millis();
-  while (toggleInternRotary == 0)
-   {
-  // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();  
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              
-        baudRateNumber = baudRateNumber - 1;
-        if (baudRateNumber < 0) baudRateNumber = baudRateNumber + noOfMenuIn;
-      }
-      else if (rotaryResult == r.clockwise()){               
-        baudRateNumber = baudRateNumber + 1;
-        if (baudRateNumber >= noOfMenuIn) baudRateNumber = baudRateNumber - noOfMenuIn;
-      }
-      lcd.setCursor(0,2); PrintFixedWidth(lcd,baudRateNumber, 2); lcd.print(" "); PrintFixedWidth(lcd, gpsBaud1[baudRateNumber], 6);
-      startTime = millis();  // reset counter if rotary is moved
-    } 
+//////////////////////////////////////////
+void MenuTimeOut()  // timer event: no activity for menuTimeOut ms
+{
+  if (menuState == MENU_ITEM && menuNumber == 0)  // subset of clock menu
+  {
+    InitScreenSelect();   //  find no of entries in menuIn
+    dispState = 0;        // go back to first submenu
+  }
+  MenuClose();
+}
 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-
-     EEPROMMyupdate(EEPROM_OFFSET1+5, baudRateNumber, 1);
-     if (baudRateNumber != oldBaudRateNumber)  
-     {
-        delay(500);
-        Serial1.end();   // close serial    // replaced restFunc() 22.02.2024
-        gpsBaud = gpsBaud1[baudRateNumber];
-        Serial1.begin(gpsBaud);  // restart with new baud rate
-       // resetFunc();  // call reset if value has changed 
-     }   
- 
-  CodeStatus();  // show relevant screen to remind operator what parameter was changed
-  delay(1500);
-  lcd.clear();
-  break;
-} // case 0 // baudrate
+//////////////////////////////////////////
+void MenuConfirmDone()  // timer event: end of confirmation screen
+{
+  MenuClose();
+}
 
- case 1: //  toggle using_PPS on / off //////////////
-  {
-    using_PPS = EEPROM.read(EEPROM_OFFSET1+9);
-    lcd.setCursor(0,2); lcd.print(F("PPS Interrupt: ")); lcd.print(using_PPS);
-    startTime = millis();
-    while (toggleInternRotary == 0)
-    { 
-    // During each loop, check the encoder to see if it has been changed.
-      volatile unsigned char rotaryResult = r.process();   
-      if (rotaryResult) {
-      if (rotaryResult == r.counterClockwise()) {              // decrease  value
-          using_PPS = !using_PPS;
-        }
-        else if (rotaryResult == r.clockwise()){               // increase  value
-          using_PPS = !using_PPS;
-        }
-      lcd.setCursor(0,2); lcd.print(F("PPS Interrupt: ")); lcd.print(using_PPS);
-      startTime = millis();  // reset counter if rotary is moved
-      }
+//////////////////////////////////////////
+void MenuConfirm()  // leave confirmation screen on display for a while, replaces delay(1500)
+{
+  StopTimer(MenuTimeOut);
+  menuState = MENU_CONFIRM;
+  StartTimer(MenuConfirmDone, 1500);
+}
 
-      if (millis() - startTime > menuTimeOut) // check for time-out and return
-          {
-            lcd.clear();
-            return;  // time-out
-          }
+//////////////////////////////////////////
+void ShowMenuTop()
+{
+  lcd.setCursor(0,0);        
+  switch(menuNumber) {
+  case 0: lcd.print(F("1. Clock subset >    ")); break;
+  case 1: lcd.print(F("2. Backlight >       ")); break;
+  case 2: lcd.print(F("3. Date format >     ")); break;
+  case 3: lcd.print(F("4. Time zone >       ")); break;
+  case 4: lcd.print(F("5. 12/24 hrs clock > ")); break;
+  case 5: lcd.print(F("6. Local language >  ")); break;
+  case 6: lcd.print(F("7. Secondary menu >  ")); break;
+  }
+}
 
-      if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-          toggleInternRotary = toggleInternRotary + 1; // internal variable
-          lcd.clear();
-      }   
-    } // while
+//////////////////////////////////////////
+void ShowSecondaryTop()
+{
+  lcd.setCursor(0,1);
+  switch (secondaryMenuNumber) { 
+  case 0: lcd.print(F("a. GPS baudrate >   ")); break;
+  case 1: lcd.print(F("b. GPS protocol >   ")); break;  // new 17.10.2026
+  case 2: lcd.print(F("c. GPS PPS >        ")); break;  // moved up from f.) 09.11.2024
+  case 3: lcd.print(F("d. Demo dwell time >")); break;
+  case 4: lcd.print(F("e. Demo step type > ")); break;
+  case 5: lcd.print(F("f. FancyClock help >")); break;
+  case 6: lcd.print(F("g. Time, math quiz >")); break;
+  case 7: lcd.print(F("h. 1st day of week >")); break;
+  case 8: lcd.print(F("i. World clock >    ")); break;  // new 17.10.2026
+  }
+}
 
-      EEPROMMyupdate(EEPROM_OFFSET1+9, using_PPS, 1);
+//////////////////////////////////////////
+void ShowSetupItem()  // value of primary menu item
+{
+  switch (menuNumber) {
+  case 0: // subset of clock menu
+    noOfStates = 0;
+    while ((menuStruct[subsetMenu].order[noOfStates] >= 0) && (noOfStates <= lengthOfMenuIn))
+      noOfStates = noOfStates + 1;                // find no of entries in this submenu
+    lcd.setCursor(0,1); lcd.print((char)(97+subsetMenu));lcd.print(F(". "));lcd.print(menuStruct[subsetMenu].descr);
+    lcd.print("(");PrintFixedWidth(lcd, noOfStates, 2);lcd.print(")");
+    break;
 
-    CodeStatus();  // show relevant screen to remind operator what parameter was changed
-    delay(1500);
-    lcd.clear();
+  case 1: // backlight
+    lcd.setCursor(0,1); PrintFixedWidth(lcd, backlightVal, 6);
     break;
-  } // case 1: using_PPS 1 or 0
 
+  case 2: // date format
+    lcd.setCursor(0,1); lcd.print((char)(97+dateFormat)); lcd.print(F(". "));lcd.print(dateTimeFormat[dateFormat].descr);
+    lcd.setCursor(0,3); LcdDate(Day, Month, Year);
+    sprintf(textBuffer, " %02d%c%02d%c%02d", Hour, dateTimeFormat[dateFormat].hourSep, Minute, dateTimeFormat[dateFormat].minSep, Seconds);
+    lcd.print(textBuffer);
+    break;
 
- case 2: // no of seconds per screen as DemoClock cycles through all screen //////////////
- {
-  dwellTimeDemo = EEPROM.read(EEPROM_OFFSET1+7);  
-  lcd.setCursor(0,2); PrintFixedWidth(lcd, dwellTimeDemo, 3); lcd.print(F(" sec per screen"));
-  startTime = millis();
-  while (toggleInternRotary == 0)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              // decrease  value
-        dwellTimeDemo = max(dwellTimeDemo - 1,  2);          // minimum time hardcoded here = 2 sec
-      }
-      else if (rotaryResult == r.clockwise()){               // increase  value
-        dwellTimeDemo = dwellTimeDemo + 1; dwellTimeDemo = min(dwellTimeDemo, 60); // maximum time hardcoded = 60 sec
-      }
-    lcd.setCursor(0,2); PrintFixedWidth(lcd, dwellTimeDemo, 3); lcd.print(F(" sec per screen"));
-    startTime = millis();  // reset counter if rotary is moved
-    }
+  case 3: // time zone
+    lcd.setCursor(0,1); PrintFixedWidth(lcd, timeZoneNumber, 2); lcd.print(F(". "));  // 17.10.2026: was a letter, now more than 26 zones
+    strcpy_P(textBuffer, timeZones[timeZoneNumber].name);
+    lcd.print(textBuffer); for (byte i = strlen(textBuffer); i < 12; i++) lcd.print(' ');
+    lcd.print(tcr -> abbrev); lcd.print(F("  "));
+    utcOffset = localTime / long(60) - utc / long(60); // order of calculation is important
+    lcd.setCursor(9,3); lcd.print(F("UTC")); 
+    if (utcOffset >=0)  lcd.print("+");
+    lcd.print(float(utcOffset)/60); lcd.print(F("  "));
+    break;
 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
+  case 4: // 12/24 hrs local time
+    lcd.setCursor(0,1); PrintFixedWidth(lcd, Twelve24Local, 1);
+    lcd.print(F(" hrs local clock  "));
+    break;
 
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1+7, dwellTimeDemo, 1);
-  DemoClock(1); // show relevant screen to remind operator what parameter was changed 
-  delay(1500);
+  case 5: // local language for day names
+    lcd.setCursor(0,1);lcd.print((char)(97+languageNumber));lcd.print(F(". "));
+    lcd.print(languages[languageNumber]);
+    nativeDayLong(localTime);
+    sprintf(todayFormatted,"%-12s", today);
+    lcd.setCursor(5,3); lcd.print(todayFormatted);
+    break;
+  }
+}
 
-  lcd.clear();
-  break;
- } // case 2: dwellTimeDemo 
+//////////////////////////////////////////
+void EnterSetupItem()  // read stored value of primary menu item
+{
+  switch (menuNumber) {
+  case 0: subsetMenu = EEPROM.read(EEPROM_OFFSET1+1);  break;
+  case 1: backlightVal = EEPROM.read(EEPROM_OFFSET1+0); break;
+  case 2: 
+    dateFormat = EEPROM.read(EEPROM_OFFSET1+2); 
+    Day = day(localTime);
+    Month = month(localTime);
+    Year = year(localTime);
+    break;
+  case 3:
+    timeZoneNumber = EEPROM.read(EEPROM_OFFSET1+4); 
+    if ((timeZoneNumber < 0) || (timeZoneNumber > NUMBER_OF_TIME_ZONES-1)) // if EEPROM stores invalid value
+       timeZoneNumber = 0;                                      // set to default value 
+    break;
+  case 4: Twelve24Local = EEPROM.read(EEPROM_OFFSET1 + 12); break;
+  case 5: languageNumber = EEPROM.read(EEPROM_OFFSET1+3);  break;
+  }
+  ShowSetupItem();
+}
 
+//////////////////////////////////////////
+void RotateSetupItem(int8_t dir)  // dir = +1 for clockwise, -1 for counter clockwise
+{
+  switch (menuNumber) {
+  case 0: // subset of clock menu
+  {
+    int noOfMenuIn = sizeof(menuStruct)/sizeof(menuStruct[0]);
+    subsetMenu = subsetMenu + dir;
+    if (subsetMenu < 0)           subsetMenu = subsetMenu + noOfMenuIn;
+    if (subsetMenu >= noOfMenuIn) subsetMenu = subsetMenu - noOfMenuIn;
+    break;
+  }
 
-case 3: // demo step type as DemoClock cycles through all screen //////////////
- {
-  demoStepType = EEPROM.read(EEPROM_OFFSET1+10);  
-  lcd.setCursor(0,2); lcd.print(F("Demo step:")); lcd.print(F("       "));
-  lcd.setCursor(11,2); lcd.print(demoStepTypeText[demoStepType]);
-  startTime = millis();
-  while (toggleInternRotary == 0)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              // decrease  value
-        demoStepType = demoStepType - 1; if (demoStepType <0) demoStepType = demoStepType + 3;
-      }
-      else if (rotaryResult == r.clockwise()){               // increase  value
-        demoStepType = demoStepType + 1; if (demoStepType > 2) demoStepType = demoStepType - 3;
-      }
-    lcd.setCursor(0,2); lcd.print(F("Demo step:")); lcd.print(F("       "));
-    lcd.setCursor(11,2); lcd.print(demoStepTypeText[demoStepType]);
-    startTime = millis();  // reset counter if rotary is moved
+  case 1: // backlight
+  {
+    byte step = 10;
+    if (dir < 0) {                                   // decrease backlight value
+      if (backlightVal <= 30) step = 2;              // smaller steps for low light (for better photos)
+      backlightVal = max(backlightVal - step,   2);
     }
-
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1+10, demoStepType, 1);
-  DemoClock(1);  // show relevant screen to remind operator what parameter was changed
-  delay(1500);
-  
-  lcd.clear();
-  break;
- } // case 3: demoStepType 
-
- 
- case 4: // time for normal clock to be on per minute in most fancy clock displays ////////////////// 
- {
-  secondsClockHelp = EEPROM.read(EEPROM_OFFSET1+6);  
-  lcd.setCursor(0,2); PrintFixedWidth(lcd, secondsClockHelp, 3); lcd.print(F(" sec per min"));
-  startTime = millis();
-  while (toggleInternRotary == 0)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              // decrease  value
-        secondsClockHelp = max(secondsClockHelp - 6,   0);
-      }
-      else if (rotaryResult == r.clockwise()){               // increase  value
-        secondsClockHelp = min(secondsClockHelp + 6, 60);
-      }
-    lcd.setCursor(0,2); PrintFixedWidth(lcd, secondsClockHelp, 3); lcd.print(F(" sec per min"));
-    startTime = millis();  // reset counter if rotary is moved
+    else {                                           // increase backlight value
+      if (backlightVal < 30) step = 2;               // smaller steps for low light (for better photos)
+      backlightVal = min(backlightVal + step, 255);
     }
+    analogWrite(LCD_PWM, backlightVal); 
+    break;
+  }
 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
+  case 2: // date format
+  {
+    int noOfMenuIn = sizeof(dateTimeFormat)/sizeof(dateTimeFormat[0]);
+    dateFormat = dateFormat + dir;
+    if (dateFormat < 0)           dateFormat = dateFormat + noOfMenuIn;
+    if (dateFormat >= noOfMenuIn) dateFormat = dateFormat - noOfMenuIn;
+    break;
+  }
 
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1+6, secondsClockHelp, 1);
-  lcd.clear();
-  break;
- } // case 4: secondsClockHelp 
+  case 3: // time zone
+    timeZoneNumber = timeZoneNumber + dir;
+    if (timeZoneNumber < 0)                        timeZoneNumber = timeZoneNumber + NUMBER_OF_TIME_ZONES;
+    if (timeZoneNumber > NUMBER_OF_TIME_ZONES - 1) timeZoneNumber = timeZoneNumber - NUMBER_OF_TIME_ZONES;
+    localTime = TzLocal(timeZoneNumber, utc, &tcr);  // 17.10.2026: was tz = *timeZones_arr[timeZoneNumber]; tz.toLocal(utc,&tcr)
+    break;
 
- case 5: // no of seconds per math quiz //////////////
- {
-  mathSecondPeriod = EEPROM.read(EEPROM_OFFSET1+8);  
-  lcd.setCursor(0,2); PrintFixedWidth(lcd, mathSecondPeriod, 3); lcd.print(F(" sec per quiz  "));
-  startTime = millis();
-  while (toggleInternRotary == 0)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              // decrease  value
-        mathSecondPeriod = max(mathSecondPeriod - 1,  1);
-      }
-      else if (rotaryResult == r.clockwise()){               // increase  value
-        mathSecondPeriod = min(mathSecondPeriod + 1, 60);
-      }
-    lcd.setCursor(0,2); PrintFixedWidth(lcd, mathSecondPeriod, 3); lcd.print(F(" sec per quiz  "));
-    startTime = millis();  // reset counter if rotary is moved
-    }
+  case 4: // 12/24 hrs local time
+    if      (Twelve24Local <= 12) Twelve24Local = 24;
+    else if (Twelve24Local  > 12) Twelve24Local = 12;
+    break;
 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
+  case 5: // local language
+  {
+    byte numLanguages = sizeof(languages) / sizeof(languages[0]);
+    languageNumber = languageNumber + dir;
+    if (languageNumber < 0)             languageNumber = languageNumber + numLanguages;
+    if (languageNumber >= numLanguages) languageNumber = languageNumber - numLanguages;
+    loadNativeCharacters(languageNumber);  // reload user-defined characters for native languages
+    break;
+  }
+  }
+  ShowSetupItem();
+}
 
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1+8, mathSecondPeriod, 1);
-  lcd.clear();
-  break;
- } // case 5: mathSecondPeriod
+//////////////////////////////////////////
+void SaveSetupItem()
+{
+  switch (menuNumber) {
+  case 0: 
+    EEPROMMyupdate(EEPROM_OFFSET1+1, subsetMenu, 1);
+    InitScreenSelect();   //  find no of entries in menuIn
+    dispState = 0;        // go back to first submenu
+    break;
+  case 1: EEPROMMyupdate(EEPROM_OFFSET1, backlightVal, 1);        break;
+  case 2: EEPROMMyupdate(EEPROM_OFFSET1+2, dateFormat, 1);        break;
+  case 3: EEPROMMyupdate(EEPROM_OFFSET1+4, timeZoneNumber, 1);    break;
+  case 4: EEPROMMyupdate(EEPROM_OFFSET1 + 12, Twelve24Local, 1);  break;
+  case 5: EEPROMMyupdate(EEPROM_OFFSET1+3, languageNumber, 1);    break;
+  }
+  MenuClose();
+}
 
-case 6: // case 6: 1st day of week //////////////
- {
-  firstDayWeek = EEPROM.read(EEPROM_OFFSET1 + 11);  
-  lcd.setCursor(3,2); //PrintFixedWidth(lcd, firstDayWeek, 3);
-  dayName(firstDayWeek-1); lcd.print(today);lcd.print(F("    "));
-  startTime = millis();
-  while (toggleInternRotary == 0)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              // decrease  value
-        firstDayWeek = firstDayWeek-1;  
-        if (firstDayWeek < 1) firstDayWeek += 7; 
-      }
-      else if (rotaryResult == r.clockwise()){               // increase  value
-        firstDayWeek = 1 + (firstDayWeek-1 + 1) % 7; 
-      }
-    lcd.setCursor(3,2); //PrintFixedWidth(lcd, firstDayWeek, 3); 
-    dayName(firstDayWeek-1);  lcd.print(today);lcd.print(F("    "));
-    
-    startTime = millis();  // reset counter if rotary is moved
+//////////////////////////////////////////
+void ShowSecondaryItem()  // value of secondary menu item
+{
+  switch (secondaryMenuNumber) {
+  case 0: // GPS baud rate
+    lcd.setCursor(0,2); PrintFixedWidth(lcd,baudRateNumber, 2); lcd.print(" "); 
+    sprintf(textBuffer, "%6lu", (unsigned long)gpsBaud1[baudRateNumber]); lcd.print(textBuffer);  // 17.10.2026: > 32767
+    break;
+  case 1: // gpsProtocol NMEA / UBX
+    lcd.setCursor(0,2); lcd.print(F("Protocol: "));
+#ifdef GPS_CONFIG_UBLOX
+    if (gpsProtocol == PROTOCOL_UBX) lcd.print(F("UBX "));
+    else                             lcd.print(F("NMEA"));
+#else
+    lcd.print(F("NMEA only"));       // UBX needs GPS_CONFIG_UBLOX in clock_hardware.h
+#endif
+    break;
+  case 2: // using_PPS on / off
+    lcd.setCursor(0,2); lcd.print(F("PPS Interrupt: ")); lcd.print(using_PPS);
+    break;
+  case 3: // no of seconds per screen as DemoClock cycles through all screen
+    lcd.setCursor(0,2); PrintFixedWidth(lcd, dwellTimeDemo, 3); lcd.print(F(" sec per screen"));
+    break;
+  case 4: // demo step type
+    lcd.setCursor(0,2); lcd.print(F("Demo step:")); lcd.print(F("       "));
+    lcd.setCursor(11,2); lcd.print(demoStepTypeText[demoStepType]);
+    break;
+  case 5: // time for normal clock to be on per minute in most fancy clock displays
+    lcd.setCursor(0,2); PrintFixedWidth(lcd, secondsClockHelp, 3); lcd.print(F(" sec per min"));
+    break;
+  case 6: // no of seconds per math quiz
+    lcd.setCursor(0,2); PrintFixedWidth(lcd, mathSecondPeriod, 3); lcd.print(F(" sec per quiz  "));
+    break;
+  case 7: // 1st day of week
+    lcd.setCursor(3,2); 
+    dayName(firstDayWeek-1); lcd.print(today);lcd.print(F("    "));
+    break;
+  case 8: // zones of world clock, one at a time: rotate to choose, push for next
+    lcd.setCursor(0,2); PrintFixedWidth(lcd, world.editSlot + 1, 2); lcd.print(F(": "));
+    if (world.editZone < 0) lcd.print(F("end of list     "));
+    else {
+      PrintFixedWidth(lcd, world.editZone, 2); lcd.print(F(" "));
+      strcpy_P(textBuffer, timeZones[world.editZone].name);
+      lcd.print(textBuffer); for (byte i = strlen(textBuffer); i < 13; i++) lcd.print(' ');
     }
-
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1 + 11, firstDayWeek, 1);
-  Progress();  // show relevant screen to remind operator what parameter was changed
-  delay(1500);
-  
-  lcd.clear();
-  break;
- } // case 6: 1st day of week
-
- default:  
-      lcd.clear();
-      return;            // exit! 
- }
+    lcd.setCursor(0,3); lcd.print(F("push: next, end    "));
+    break;
+  }
 }
-/////////////////// ROTARY -> SETUP PARAMETERS ///////////////////
 
-void RotarySetup()  //  May-June 2023
+//////////////////////////////////////////
+void EnterSecondaryItem()  // read stored value of secondary menu item
 {
-  int menuNumber = 0; 
-  int maxMenuNumber = 6;  // for the 0-6 cases below
-  int toggleInternRotary = 0;
-
-  uint32_t startTime; // for time-out out of menu
-
-  #ifdef FEATURE_SERIAL_TIME   // OK her   
- //       Serial.print(F("A: timeZoneNumber "));Serial.print(timeZoneNumber);Serial.print(F(" "));Serial.println(tcr[timeZoneNumber] -> abbrev);
-  #endif
-  
-  lcd.clear();
-  lcd.setCursor(0,0); lcd.print(F("1. Clock subset >   ")); // menuNumber = 0
-
-// Top-level: Select which menu to enter: 
-
-    startTime = millis();
-    while (toggleInternRotary == 0)
-    {
-    volatile unsigned char rotaryResultTop = r.process();
-      if (rotaryResultTop) {
-        if (rotaryResultTop == r.counterClockwise()) { 
-          menuNumber = menuNumber - 1;
-          if (menuNumber < 0) menuNumber = menuNumber + maxMenuNumber + 1;
-        }
-        else if (rotaryResultTop == r.clockwise()){   
-          menuNumber = menuNumber + 1;
-          if (menuNumber > maxMenuNumber) menuNumber = menuNumber - maxMenuNumber - 1;
-        }
-        lcd.setCursor(0,0);        
-        switch(menuNumber) {
-        case 0: lcd.print(F("1. Clock subset >    ")); break;
-        case 1: lcd.print(F("2. Backlight >       ")); break;
-        case 2: lcd.print(F("3. Date format >     ")); break;
-        case 3: lcd.print(F("4. Time zone >       ")); break;
-        case 4: lcd.print(F("5. 12/24 hrs clock > ")); break;
-        case 5: lcd.print(F("6. Local language >  ")); break;
-        case 6: lcd.print(F("7. Secondary menu >  ")); break;
-         }
-        startTime = millis();  // reset counter if rotary is moved
-        }
-        if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          menuNumber = 99; // do nothing
-          lcd.clear();       // 07.08.2023
-          return;  // time-out
-        }
-    
-     if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-            toggleInternRotary = 1;                // goto next level
-     }
-    } // while
-///// end top-level /////////////
-
-  #ifdef FEATURE_SERIAL_TIME   // problem allerede her   
- //       Serial.print(F("B: timeZoneNumber "));Serial.print(timeZoneNumber);Serial.print(F(" "));Serial.println(tcr[timeZoneNumber] -> abbrev);
+  #ifdef FEATURE_SERIAL_MENU
+      Serial.print(F("2ndary # ")); Serial.println(secondaryMenuNumber);
   #endif
 
-switch (menuNumber) {
+  switch (secondaryMenuNumber) {
+  case 0: 
+    baudRateNumber = EEPROM.read(EEPROM_OFFSET1+5); 
+    oldBaudRateNumber = baudRateNumber;
+    #ifdef FEATURE_SERIAL_MENU
+      Serial.print(F("baudRateNumber ")); Serial.println(baudRateNumber);
+      Serial.println(gpsBaud1[baudRateNumber]);
+    #endif
+    break;
+  case 1: gpsProtocol = EEPROM.read(EEPROM_OFFSET1 + 13);      break;
+  case 2: using_PPS = EEPROM.read(EEPROM_OFFSET1+9);            break;
+  case 3: dwellTimeDemo = EEPROM.read(EEPROM_OFFSET1+7);        break;
+  case 4: demoStepType = EEPROM.read(EEPROM_OFFSET1+10);        break;
+  case 5: secondsClockHelp = EEPROM.read(EEPROM_OFFSET1+6);     break;
+  case 6: mathSecondPeriod = EEPROM.read(EEPROM_OFFSET1+8);     break;
+  case 7: firstDayWeek = EEPROM.read(EEPROM_OFFSET1 + 11);      break;
+  case 8: 
+    WorldLoad();
+    world.editSlot = 0;
+    world.editZone = world.zone[0];
+    break;
+  }
+  ShowSecondaryItem();
+}
 
-case 0: // 0000000000 subset of clock menu ////////////////////////
+//////////////////////////////////////////
+void RotateSecondaryItem(int8_t dir)  // dir = +1 for clockwise, -1 for counter clockwise
 {
-  subsetMenu = EEPROM.read(EEPROM_OFFSET1+1); 
-  startTime = millis();
-  int noOfMenuIn = sizeof(menuStruct)/sizeof(menuStruct[0]);
-  
-  noOfStates = 0;
-  while ((menuStruct[subsetMenu].order[noOfStates] >= 0) && (noOfStates <= lengthOfMenuIn))
-        noOfStates = noOfStates + 1;                // find no of entries in this submenu
-  lcd.setCursor(0,1); lcd.print((char)(97+subsetMenu));lcd.print(F(". "));lcd.print(menuStruct[subsetMenu].descr);
-  lcd.print("(");PrintFixedWidth(lcd, noOfStates, 2);lcd.print(")");
-  
-  while (toggleInternRotary == 1)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResultSubset = r.process();   
-    if (rotaryResultSubset) {
-    if (rotaryResultSubset == r.counterClockwise()) {              
-        subsetMenu = subsetMenu - 1;
-          if (subsetMenu < 0) subsetMenu = subsetMenu + noOfMenuIn ;
-      }
-      else if (rotaryResultSubset == r.clockwise()){               
-        subsetMenu = (subsetMenu + 1);
-          if (subsetMenu >= noOfMenuIn) subsetMenu = subsetMenu - noOfMenuIn ;
-      }
-
-      noOfStates = 0;
-      while ((menuStruct[subsetMenu].order[noOfStates] >= 0) && (noOfStates <= lengthOfMenuIn))
-        noOfStates = noOfStates + 1;                // find no of entries in this submenu
-      lcd.setCursor(0,1); lcd.print((char)(97+subsetMenu));lcd.print(F(". "));lcd.print(menuStruct[subsetMenu].descr);
-      lcd.print("(");PrintFixedWidth(lcd, noOfStates, 2);lcd.print(")");
-      startTime = millis();  // reset counter if rotary is moved
-    } 
-
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          InitScreenSelect();   //  find no of entries in menuIn
-          dispState = 0; // go back to first submenu
-          return;  // time-out
-        }
-    if (r.buttonPressedReleased(25)) {               // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // jump out of while()
-        lcd.clear();
-    }   
-  } // while
-
-EEPROMMyupdate(EEPROM_OFFSET1+1, subsetMenu, 1);
-InitScreenSelect();   //  find no of entries in menuIn
-dispState = 0; // go back to first submenu
-lcd.clear();  
-break;
-} // case 0: subset of clock menu 
-
-
- case 1: // 1111111111 backlight ////////////////// 
- {
-  backlightVal = EEPROM.read(EEPROM_OFFSET1+0);  
-  lcd.setCursor(0,1); PrintFixedWidth(lcd, backlightVal, 6);
-  startTime = millis();
-  byte step = 10;
-  while (toggleInternRotary == 1)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResultBacklight = r.process();   
-    if (rotaryResultBacklight) {
-      step = 10;
-    if (rotaryResultBacklight == r.counterClockwise()) {              // decrease backlight value
-        if (backlightVal <= 30) step = 2;            // smaller steps for low light (for better photos)
-        backlightVal = max(backlightVal - step,   2);
-      }
-      else if (rotaryResultBacklight == r.clockwise()){               // increase backlight value
-        if (backlightVal < 30) step = 2;            // smaller steps for low light (for better photos)
-        backlightVal = min(backlightVal + step, 255);
-      }
-    lcd.setCursor(0,1); PrintFixedWidth(lcd, backlightVal, 6);
-    analogWrite(LCD_PWM, backlightVal); 
-    startTime = millis();  // reset counter if rotary is moved
+  switch (secondaryMenuNumber) {
+  case 0: 
+  {
+    int noOfMenuIn = sizeof(gpsBaud1)/sizeof(gpsBaud1[1]); 
+    baudRateNumber = baudRateNumber + dir;
+    if (baudRateNumber < 0)           baudRateNumber = baudRateNumber + noOfMenuIn;
+    if (baudRateNumber >= noOfMenuIn) baudRateNumber = baudRateNumber - noOfMenuIn;
+    break;
+  }
+  case 1:
+#ifdef GPS_CONFIG_UBLOX  // UBX output is only turned on with UBX-CFG-MSG, clock_gpsconfig.h
+    gpsProtocol = (gpsProtocol == PROTOCOL_UBX) ? PROTOCOL_NMEA : PROTOCOL_UBX;
+#endif
+    break;
+  case 2: using_PPS = !using_PPS; break;
+  case 3: 
+    if (dir < 0) dwellTimeDemo = max(dwellTimeDemo - 1,  2);   // minimum time hardcoded here = 2 sec
+    else         dwellTimeDemo = min(dwellTimeDemo + 1, 60);   // maximum time hardcoded = 60 sec
+    break;
+  case 4:
+    demoStepType = demoStepType + dir; 
+    if (demoStepType < 0) demoStepType = demoStepType + 3;
+    if (demoStepType > 2) demoStepType = demoStepType - 3;
+    break;
+  case 5:
+    if (dir < 0) secondsClockHelp = max(secondsClockHelp - 6,   0);
+    else         secondsClockHelp = min(secondsClockHelp + 6, 60);
+    break;
+  case 6:
+    if (dir < 0) mathSecondPeriod = max(mathSecondPeriod - 1,  1);
+    else         mathSecondPeriod = min(mathSecondPeriod + 1, 60);
+    break;
+  case 7:
+    if (dir < 0) {
+      firstDayWeek = firstDayWeek-1;  
+      if (firstDayWeek < 1) firstDayWeek += 7; 
     }
+    else firstDayWeek = 1 + (firstDayWeek-1 + 1) % 7; 
+    break;
+  case 8:  // -1 = end of list, not for first zone
+    world.editZone = world.editZone + dir;
+    if (world.editZone < (world.editSlot > 0 ? -1 : 0)) world.editZone = NUMBER_OF_TIME_ZONES - 1;
+    if (world.editZone >= NUMBER_OF_TIME_ZONES)         world.editZone = (world.editSlot > 0) ? -1 : 0;
+    break;
+  }
+  ShowSecondaryItem();
+}
 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // jump out of while()
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1, backlightVal, 1);
-  lcd.clear();
-  break;
- } // case 1: backlight 
-
- 
-case 2: // 2222222222 date format ////////////////
-// code from here instead ? https://stackoverflow.com/questions/53679924/how-to-constrain-a-value-within-a-range
- { 
-  dateFormat = EEPROM.read(EEPROM_OFFSET1+2); 
-  Day = day(localTime);
-  Month = month(localTime);
-  Year = year(localTime);
-  
-  lcd.setCursor(0,1); lcd.print((char)(97+dateFormat)); lcd.print(F(". "));lcd.print(dateTimeFormat[dateFormat].descr);
-  lcd.setCursor(0,3); LcdDate(Day, Month, Year);
-  sprintf(textBuffer, " %02d%c%02d%c%02d", Hour, dateTimeFormat[dateFormat].hourSep, Minute, dateTimeFormat[dateFormat].minSep, Seconds);
-  lcd.print(textBuffer);
-  
-  int noOfMenuIn = sizeof(dateTimeFormat)/sizeof(dateTimeFormat[0]);
-
-  startTime = millis();
-  while (toggleInternRotary == 1)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              
-        dateFormat = dateFormat - 1;
-        if (dateFormat < 0) dateFormat = dateFormat + noOfMenuIn;
-      }
-      else if (rotaryResult == r.clockwise()){               
-        dateFormat = dateFormat + 1;
-        if (dateFormat >= noOfMenuIn) dateFormat = dateFormat - noOfMenuIn;
-      }
-
-      lcd.setCursor(0,1); lcd.print((char)(97+dateFormat)); lcd.print(F(". "));lcd.print(dateTimeFormat[dateFormat].descr);
-      lcd.setCursor(0,3); LcdDate(Day, Month, Year);
-      sprintf(textBuffer, " %02d%c%02d%c%02d", Hour, dateTimeFormat[dateFormat].hourSep, Minute, dateTimeFormat[dateFormat].minSep, Seconds);
-      lcd.print(textBuffer);
-
-      //lcd.print(dateTimeFormat[dateFormat].dateOrder);  PrintFixedWidth(lcd, dateFormat, 3);
-      startTime = millis();  // reset counter if rotary is moved
-    } 
-
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // jump out of while()
-        lcd.clear();
-    }   
-  } // while
-
-  EEPROMMyupdate(EEPROM_OFFSET1+2, dateFormat, 1);
+//////////////////////////////////////////
+void SaveSecondaryItem()
+{
   lcd.clear();
-  break;
- }  // case 2: date format
- 
-
-case 3: // 333333333 time zone /////////////////////////////////////////
-{ 
-  #ifdef FEATURE_SERIAL_TIME      
-//        Serial.print(F("C: timeZoneNumber "));Serial.print(timeZoneNumber);Serial.print(F(" "));Serial.println(tcr[timeZoneNumber] -> abbrev);
-  #endif
-  
-  lcd.setCursor(0,1);
-
-  timeZoneNumber = EEPROM.read(EEPROM_OFFSET1+4); 
-  if ((timeZoneNumber < 0) || (timeZoneNumber >= NUMBER_OF_TIME_ZONES-1)) // if EEPROM stores invalid value
-       timeZoneNumber = 0;                                      // set to default value 
-
-  lcd.setCursor(0,1); lcd.print((char)(97+timeZoneNumber)); //PrintFixedWidth(lcd, timeZoneNumber, 2); 
-  lcd.print(F(". ")); lcd.print(tcr -> abbrev);lcd.print(F("  "));
-
-  lcd.setCursor(9,3); lcd.print(F("UTC"));
-  utcOffset = localTime / long(60) - utc / long(60); // order of calculation is important 
-  if (utcOffset >=0)  lcd.print("+");
-  lcd.print(float(utcOffset)/60); lcd.print(F("  "));
-
-  int firstZone = 0;// 1;// 0; first index used in tcr and local: only !=0 for debugging
-  
-  startTime = millis();
-  while (toggleInternRotary == 1)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              
-        timeZoneNumber = timeZoneNumber - 1;
-        if (timeZoneNumber < firstZone) timeZoneNumber = timeZoneNumber + NUMBER_OF_TIME_ZONES - firstZone;
-      }
-      else if (rotaryResult == r.clockwise()){               
-        timeZoneNumber = timeZoneNumber + 1;
-        if (timeZoneNumber > NUMBER_OF_TIME_ZONES-1) timeZoneNumber = timeZoneNumber - NUMBER_OF_TIME_ZONES + firstZone;
-      }
-#ifdef FEATURE_SERIAL_TIME      
- //       Serial.print(F("Z: timeZoneNumber "));Serial.print(timeZoneNumber);Serial.print(F(" "));Serial.println(tcr[timeZoneNumber] -> abbrev);
-#endif
-      
-      lcd.setCursor(0,1); lcd.print((char)(97+timeZoneNumber)); lcd.print(F(". "));
-      
-      tz = *timeZones_arr[timeZoneNumber]; 
-      localTime = tz.toLocal(utc,&tcr);
-
-      lcd.print(tcr -> abbrev);lcd.print(F("  "));
-      utcOffset = localTime / long(60) - utc / long(60); // order of calculation is important
-      lcd.setCursor(9,3); lcd.print(F("UTC")); 
-      if (utcOffset >=0)  lcd.print("+");
-      lcd.print(float(utcOffset)/60); lcd.print(F("  "));
-  
-      startTime = millis();  // reset counter if rotary is moved
-    } 
-
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // jump out of while()
+  switch (secondaryMenuNumber) {
+  case 0: 
+    EEPROMMyupdate(EEPROM_OFFSET1+5, baudRateNumber, 1);
+    if (baudRateNumber != oldBaudRateNumber)  
+    {
+      GpsSetBaud(gpsBaud1[baudRateNumber]);  // 17.10.2026: receiver changes too, clock_gpsconfig.h
+      AutobaudSet(baudRateNumber);           // restart serial with new baud rate, replaced restFunc() 22.02.2024
     }   
-  } // while
- 
-  EEPROMMyupdate(EEPROM_OFFSET1+4, timeZoneNumber, 1);
-  lcd.clear();
-  break;
-}  // case 3: time zone 
-
-
-case 4: // case 4: 12/24 hrs local time //////////////
-{
-  Twelve24Local = EEPROM.read(EEPROM_OFFSET1 + 12);  
-  lcd.setCursor(0,1); PrintFixedWidth(lcd, Twelve24Local, 1);
-  lcd.print(F(" hrs local clock  "));
-  startTime = millis();
-  while (toggleInternRotary == 1)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();   
-    if (rotaryResult) {
-      if      (Twelve24Local <= 12) Twelve24Local = 24;
-      else if (Twelve24Local  > 12) Twelve24Local = 12;
-      lcd.setCursor(0,1); lcd.print(Twelve24Local); 
-      startTime = millis();  // reset counter if rotary is moved
+    CodeStatus();  // show relevant screen to remind operator what parameter was changed
+    MenuConfirm();
+    break;
+  case 1:
+    EEPROMMyupdate(EEPROM_OFFSET1 + 13, gpsProtocol, 1);
+    CodeStatus();
+    MenuConfirm();
+    break;
+  case 2: 
+    EEPROMMyupdate(EEPROM_OFFSET1+9, using_PPS, 1);
+    CodeStatus();  
+    MenuConfirm();
+    break;
+  case 3:
+    EEPROMMyupdate(EEPROM_OFFSET1+7, dwellTimeDemo, 1);
+    DemoClock(1); 
+    MenuConfirm();
+    break;
+  case 4:
+    EEPROMMyupdate(EEPROM_OFFSET1+10, demoStepType, 1);
+    DemoClock(1); 
+    MenuConfirm();
+    break;
+  case 5:
+    EEPROMMyupdate(EEPROM_OFFSET1+6, secondsClockHelp, 1);
+    MenuClose();
+    break;
+  case 6:
+    EEPROMMyupdate(EEPROM_OFFSET1+8, mathSecondPeriod, 1);
+    MenuClose();
+    break;
+  case 7:
+    EEPROMMyupdate(EEPROM_OFFSET1 + 11, firstDayWeek, 1);
+    MomentFill();  // 17.10.2026: not from DrawScreen()
+    Progress(); 
+    MenuConfirm();
+    break;
+  case 8:
+    if (world.editZone >= 0) world.zone[world.editSlot++] = world.editZone;
+    world.page = -1;  // shown zones may have changed
+    if (world.editZone >= 0 && world.editSlot < WORLD_ZONES_MAX) {  // next zone, stay in this item
+      if (world.editSlot >= world.count) world.editZone = -1;       // after the list: end, or add one
+      else                               world.editZone = world.zone[world.editSlot];
+      ShowSecondaryTop();
+      ShowSecondaryItem();
+      break;
     }
+    world.count = world.editSlot;
+    WorldSave();
+    lcd.setCursor(0,0); lcd.print(F("World clock:"));
+    lcd.setCursor(0,1); PrintFixedWidth(lcd, world.count, 2); lcd.print(F(" zones, ")); lcd.print(WorldPages()); lcd.print(F(" pages"));
+    MenuConfirm();
+    break;
+  default:
+    MenuClose();
+  }
+}
 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // internal variable
-        lcd.clear();
-    }   
-  } // while
-  
-  EEPROMMyupdate(EEPROM_OFFSET1 + 12, Twelve24Local, 1);
-  //Progress();  // show relevant screen to remind operator what parameter was changed
-  //delay(1500);
-  
+//////////////////////////////////////////
+void RotarySetup()  //  May-June 2023. Opens menu, 17.10.2026: the rest is done in RotarySetupStep()
+{
+  menuNumber = 0; 
+  menuState = MENU_TOP;
   lcd.clear();
-  break;
-}  // case 4: 12/24 hrs local time
+  lcd.setCursor(0,0); lcd.print(F("1. Clock subset >   ")); // menuNumber = 0
+  StartTimer(MenuTimeOut, menuTimeOut);
+}
 
- case 5: // 55555 local language for day names /////////////////////
- {
-  languageNumber = EEPROM.read(EEPROM_OFFSET1+3); 
-  startTime = millis();
-  byte numLanguages = sizeof(languages) / sizeof(languages[0]);
-  
-  lcd.setCursor(0,1);
-  lcd.print((char)(97+languageNumber));lcd.print(F(". "));lcd.print(languages[languageNumber]);     
-   
-  nativeDayLong(localTime);
-  sprintf(todayFormatted,"%-12s", today);
-  lcd.setCursor(5,3); lcd.print(todayFormatted);
+//////////////////////////////////////////
+void RotarySetupStep(unsigned char rotaryResult)  // called from checkEncoder() while the menu is open
+{
+  if (menuState == MENU_CONFIRM) return;  // wait for timer event
 
-  while (toggleInternRotary == 1)
-  { 
-   // During each loop, check the encoder to see if it has been changed.
-     volatile unsigned char rotaryResult = r.process();
-    if (rotaryResult) {    
-    if (rotaryResult == r.counterClockwise()) {              
-        languageNumber = languageNumber - 1;
-        if (languageNumber < 0) languageNumber = languageNumber + numLanguages;
-      }
-      else if (rotaryResult == r.clockwise()){               
-        languageNumber = languageNumber + 1;
-          if (languageNumber >= numLanguages) languageNumber = languageNumber - numLanguages;
-      }
-     
-      lcd.setCursor(0,1);lcd.print((char)(97+languageNumber));lcd.print(F(". "));  // OK
-      lcd.print(languages[languageNumber]);
-      loadNativeCharacters(languageNumber);  // reload user-defined characters for native languages
-      
-      nativeDayLong(localTime);
-      sprintf(todayFormatted,"%-12s", today);
-      lcd.setCursor(5,3);; lcd.print(todayFormatted);
+  int8_t dir = 0;
+  if (rotaryResult == r.counterClockwise()) dir = -1;
+  else if (rotaryResult == r.clockwise())   dir = +1;
 
-      startTime = millis();  // reset counter if rotary is moved
-    }  // this bracket was placed higher up, so lcd.print was performed continuously, OK for Mega, but Metro was deaf to rotary switch. 17.2.2024
- 
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }       
+  bool pressed = r.buttonPressedReleased(25);   // 25ms = debounce_delay
 
-    if (r.buttonPressedReleased(25)) {               // 25ms = debounce_delay
-        toggleInternRotary = toggleInternRotary + 1; // jump out of while()
-        lcd.clear();
-    }   
-  } // while
+  if (dir == 0 && !pressed) return;
+  StartTimer(MenuTimeOut, menuTimeOut);  // reset time-out if rotary is moved or pushed
 
-  EEPROMMyupdate(EEPROM_OFFSET1+3, languageNumber, 1); 
-  lcd.clear();
-  break;
-  
- }  // case 5: local language 
- 
-case 6: // 666666 Secondary menu //////////////
- {
-  int noOfMenuIn = 7;       // no of secondary menu items 7: 18.11.2024
-  lcd.setCursor(0,1); lcd.print(F("a. GPS baudrate >    "));
-  
-  startTime = millis();
-  secondaryMenuNumber = 0;
-  while (toggleInternRotary == 1)
-   {
-  // During each loop, check the encoder to see if it has been changed.
-    volatile unsigned char rotaryResult = r.process();  
-    if (rotaryResult) {
-    if (rotaryResult == r.counterClockwise()) {              
-        secondaryMenuNumber = secondaryMenuNumber - 1;
-        if (secondaryMenuNumber < 0) secondaryMenuNumber = secondaryMenuNumber + noOfMenuIn;
-      }
-      else if (rotaryResult == r.clockwise()){               
-        secondaryMenuNumber = secondaryMenuNumber + 1;
-        if (secondaryMenuNumber >= noOfMenuIn) secondaryMenuNumber = secondaryMenuNumber - noOfMenuIn;
+  switch (menuState) {
+  case MENU_TOP:
+    if (pressed) {                // goto next level
+      if (menuNumber == 6) {      // secondary menu
+        secondaryMenuNumber = 0;
+        menuState = MENU_SECONDARY;
+        ShowSecondaryTop();
       }
-      lcd.setCursor(0,1);
-      switch (secondaryMenuNumber) { 
-      case 0: lcd.print(F("a. GPS baudrate >   ")); break;
-      case 1: lcd.print(F("b. GPS PPS >        ")); break;  // moved up from f.) 09.11.2024
-      case 2: lcd.print(F("c. Demo dwell time >")); break;
-      case 3: lcd.print(F("d. Demo step type > ")); break;
-      case 4: lcd.print(F("e. FancyClock help >")); break;
-      case 5: lcd.print(F("f. Time, math quiz >")); break;
-      case 6: lcd.print(F("g. 1st day of week >")); break;
-      // if ((menuOrder[ScreenProgress] > 0) && (menuOrder[ScreenProgress] <= lengthOfMenuIn))   // this screen is in the set of screens selected
-      // {
-      //   lcd.print(F("g. 1st day, scr ")); lcd.print(menuOrder[ScreenProgress]); lcd.print(F(" >"));
-      // }
-      //   else lcd.print(F("g. 1st day         >"));
-      // break;
+      else {
+        menuState = MENU_ITEM;
+        EnterSetupItem();
       }
-      startTime = millis();  // reset counter if rotary is moved
-    } 
-
-    if (millis() - startTime > menuTimeOut) // check for time-out and return
-        {
-          lcd.clear();
-          return;  // time-out
-        }
-    if (r.buttonPressedReleased(25)) {            // 25ms = debounce_delay
-        RotarySecondarySetup();  // secondaryMenuNumber is interpreted by RotarySecondarySetup
-        return;
-    }   
-  } // while
+    }
+    else {
+      menuNumber = menuNumber + dir;
+      if (menuNumber < 0)             menuNumber = menuNumber + maxMenuNumber + 1;
+      if (menuNumber > maxMenuNumber) menuNumber = menuNumber - maxMenuNumber - 1;
+      ShowMenuTop();
+    }
+    break;
 
-  //lcd.clear();
-  break;
-} // case 6 // secondary menu
+  case MENU_ITEM:
+    if (pressed) SaveSetupItem();
+    else         RotateSetupItem(dir);
+    break;
 
+  case MENU_SECONDARY:
+    if (pressed) {
+      menuState = MENU_SECONDARY_ITEM;
+      lcd.setCursor(0,2);
+      EnterSecondaryItem();
+    }
+    else {
+      secondaryMenuNumber = secondaryMenuNumber + dir;
+      if (secondaryMenuNumber < 0)                    secondaryMenuNumber = secondaryMenuNumber + noOfSecondaryMenuIn;
+      if (secondaryMenuNumber >= noOfSecondaryMenuIn) secondaryMenuNumber = secondaryMenuNumber - noOfSecondaryMenuIn;
+      ShowSecondaryTop();
+    }
+    break;
 
-default:  
-      return;            // exit!     
+  case MENU_SECONDARY_ITEM:
+    if (pressed) SaveSecondaryItem();
+    else         RotateSecondaryItem(dir);
+    break;
 
-} // switch
-  
+  default:
+    MenuClose();
+  }
 }
 
 ////////////////////////////////////////////////
@@ -2304,91 +2037,39 @@ void GPSParse()
       Serial.println(F("*** Enter  GPSParse"));
     #endif
 
-  if (totalGPGSVMessages.isUpdated())    
+  // 17.10.2026: sats[] is filled from $xxGSV by NmeaEncode() in clock_nmea.h, see clock_satellites.h
+  // nmea.gsvCycle is set after the last message of a complete cycle
+  static uint32_t lastExpire = 0;
+  if (millis() - lastExpire >= 1000)
   {
-    for (int i=0; i<4; ++i)
-    {
-      int no = atoi(satNumber[i].value());
-      #ifdef FEATURE_SERIAL_GPS
-            Serial.print(F("SatNumber is ")); Serial.println(no);
-      #endif
-              
-        if (no >= 1 && no <= MAX_SATELLITES)
-        {
-          sats[no-1].elevation = atoi(elevation[i].value());
-          sats[no-1].azimuth = atoi(azimuth[i].value());
-          sats[no-1].snr = atoi(snr[i].value());
-//                sats[no-1].snr = min(sats[no-1].snr, 99);    // to limit wild values 30.05.2023
-          sats[no-1].active = true;
-        }
-        #ifdef FEATURE_SERIAL_GPS
-        //      Serial.print(F(", SNR ")); Serial.println(sats[no-1].snr);
-        #endif  
-    }
+    lastExpire += 1000;
+    SatExpire();
+    LinkSecond();  // rates of serial link from GPS, clock_gpslink.h
+    AutobaudSecond();  // new baud rate if no valid data for a while, clock_autobaud.h
+    PositionUpdate();  // new position.version if moved or new fix quality, clock_position.h
+    GpsConfigCheck();  // messages from receiver for screens in menu and screen shown, clock_gpsconfig.h
+  }
 
-      int totalMessages = atoi(totalGPGSVMessages.value());
-      int currentMessage = atoi(messageNumber.value());
-      if (totalMessages == currentMessage)
-      {   
-        #ifdef FEATURE_SERIAL_GPS 
-          Serial.print(F("Sats=")); Serial.print(gps.satellites.value());
-          Serial.print(F(" Nums="));
-        #endif
-       
-        #ifdef FEATURE_SERIAL_GPS 
-        for (int i=0; i<MAX_SATELLITES; ++i)
-          if (sats[i].active)
-          {
-            Serial.print(i+1);
-            Serial.print(F(" "));
-          }
-        Serial.print(F(" Elevation="));
-        for (int i=0; i<MAX_SATELLITES; ++i)
-          if (sats[i].active)
-          {
-            Serial.print(sats[i].elevation);
-            Serial.print(F(" "));
-          }
-        Serial.println();
-        Serial.print(F("        Azimuth="));
-        
+  if (nmea.gsvCycle)    
+  {
+      nmea.gsvCycle = false;
+      SatTotals();
+
+      #ifdef FEATURE_SERIAL_GPS 
+        Serial.print(F("Sats=")); Serial.print(gnss.satellites.value());
+        Serial.print(F(" Tracked=")); Serial.print(totalSats);
+        Serial.print(F(" SNRAvg=")); Serial.println(SNRAvg);
         for (int i=0; i<MAX_SATELLITES; ++i)
-          if (sats[i].active)
+          if (sats[i].prn != 0)
           {
-            Serial.print(sats[i].azimuth);
-            Serial.print(F(" "));
+            Serial.print(F("  ")); Serial.print(sats[i].system);
+            Serial.print(F(" PRN ")); Serial.print(sats[i].prn);
+            Serial.print(F(" El ")); Serial.print(sats[i].elevation);
+            Serial.print(F(" Az ")); Serial.print(sats[i].azimuth);
+            Serial.print(F(" SNR ")); Serial.println(sats[i].snr);
           }
-        
-          Serial.print(F(" SNR="));
-        #endif
-          SNRAvg = 0.0;
-          totalSats = 0;
-          for (int i=0; i<MAX_SATELLITES; ++i)
-          if (sats[i].active)
-           {
-             #ifdef FEATURE_SERIAL_GPS
-               Serial.print(sats[i].snr);
-               Serial.print(F(" "));
-             #endif
-            if (sats[i].snr >0)          // 0 when not tracking
-             {
-              totalSats = totalSats + 1; 
-              SNRAvg = SNRAvg + float(sats[i].snr);
-             }
-           }
-          if (totalSats>0) SNRAvg = SNRAvg/totalSats; 
-          else                      SNRAvg = 0;               // 16.11.2022
-        
-          #ifdef FEATURE_SERIAL_GPS
-            Serial.println();Serial.print(" SNRAvg "); Serial.print(SNRAvg); 
-            Serial.print(", "); Serial.println(round(SNRAvg));
-          #endif
-
-          for (int i=0; i<MAX_SATELLITES; ++i)
-          sats[i].active = false;
-      }
-
-  } // (totalGPGSVMessages.isUpdated())
+      #endif
+  } // (nmea.gsvCycle)
 
     #ifdef FEATURE_SERIAL_GPS 
       Serial.println(F("*** Exit  GPSParse"));
@@ -2404,8 +2085,6 @@ const byte downArray[8]       PROGMEM = {0x4, 0x4, 0x4, 0x4, 0x15, 0xe, 0x4, 0x0
 
 void loadArrowCharacters()
 {
-  if (LCDchar0_3 != LCDARROWS)
-  {
   // upload characters to the lcd
   memcpy_P(buffer,upDashedArray, 8);
   lcd.createChar(DASHED_UP_ARROW, buffer);
@@ -2415,14 +2094,6 @@ void loadArrowCharacters()
   lcd.createChar(UP_ARROW, buffer);
   memcpy_P(buffer,downArray, 8); 
   lcd.createChar((byte)DOWN_ARROW, buffer);
-  lcd.clear();  // in order to set the LCD back to the proper memory mode after custom characters have been created
-
-  LCDchar0_3 = LCDARROWS;
-  
-  #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-     Serial.println(F("loadArrowCharacters"));
-  #endif
-  }
 
 }
 
@@ -2473,26 +2144,15 @@ const byte fourFilled[8] PROGMEM = {
 
 void loadSimpleBarCharacters()
 {
-
-  if (LCDchar0_3 != LCDBARS)
-  {
-    // upload characters to the lcd
-      memcpy_P(buffer,oneFilled, 8);
-      lcd.createChar(ONE_BAR, buffer);
-      memcpy_P(buffer,twoFilled, 8);
-      lcd.createChar(TWO_BARS, buffer);
-      memcpy_P(buffer,threeFilled, 8);
-      lcd.createChar(THREE_BARS, buffer);
-      memcpy_P(buffer,fourFilled, 8);
-      lcd.createChar(FOUR_BARS, buffer);
-      lcd.clear();  // in order to set the LCD back to the proper memory mode after custom characters have been created
-
-      LCDchar0_3 = LCDBARS;
-
-      #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-        Serial.println(F("loadSimpleBarCharacters"));
-      #endif
-  }
+  // upload characters to the lcd
+  memcpy_P(buffer,oneFilled, 8);
+  lcd.createChar(ONE_BAR, buffer);
+  memcpy_P(buffer,twoFilled, 8);
+  lcd.createChar(TWO_BARS, buffer);
+  memcpy_P(buffer,threeFilled, 8);
+  lcd.createChar(THREE_BARS, buffer);
+  memcpy_P(buffer,fourFilled, 8);
+  lcd.createChar(FOUR_BARS, buffer);
 }
 
 
@@ -2601,37 +2261,23 @@ const byte LMB[8] PROGMEM =
 void loadThreeWideDigits()
 // https://forum.arduino.cc/t/large-alphanumeric-on-lcd/8946/3
 {
-
-  if (LCDchar0_3 != LCD3WIDE || LCDchar4_5 != LCD3WIDE || LCDchar6_7 != LCD3WIDE)
-  {
-
-    // assignes each segment a write number
-    memcpy_P(buffer,LT, 8);
-    lcd.createChar((byte)0 , buffer);
-    memcpy_P(buffer,UB, 8);
-    lcd.createChar(1 , buffer);
-    memcpy_P(buffer,RT, 8);
-    lcd.createChar(2 , buffer);
-    memcpy_P(buffer,LL, 8);
-    lcd.createChar(3 , buffer);
-    memcpy_P(buffer,LB, 8);
-    lcd.createChar(4 , buffer);
-    memcpy_P(buffer,LR, 8);
-    lcd.createChar(5 , buffer);
-    memcpy_P(buffer,UMB, 8);
-    lcd.createChar(6 , buffer);
-    memcpy_P(buffer,LMB, 8);
-    lcd.createChar(7 , buffer);
-    lcd.clear();  // in order to set the LCD back to the proper memory mode after custom characters have been created
-
-    LCDchar0_3 = LCD3WIDE;
-    LCDchar4_5 = LCD3WIDE;
-    LCDchar6_7 = LCD3WIDE;
-
-    #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-            Serial.println(F("loadThreeWideDigits"));
-    #endif
-  }
+  // assignes each segment a write number
+  memcpy_P(buffer,LT, 8);
+  lcd.createChar((byte)0 , buffer);
+  memcpy_P(buffer,UB, 8);
+  lcd.createChar(1 , buffer);
+  memcpy_P(buffer,RT, 8);
+  lcd.createChar(2 , buffer);
+  memcpy_P(buffer,LL, 8);
+  lcd.createChar(3 , buffer);
+  memcpy_P(buffer,LB, 8);
+  lcd.createChar(4 , buffer);
+  memcpy_P(buffer,LR, 8);
+  lcd.createChar(5 , buffer);
+  memcpy_P(buffer,UMB, 8);
+  lcd.createChar(6 , buffer);
+  memcpy_P(buffer,LMB, 8);
+  lcd.createChar(7 , buffer);
 }
 
 // position in display
@@ -2886,32 +2532,20 @@ const byte c6[8] PROGMEM =  // colon
 void loadThreeHighDigits2()
 {
 
-  if (LCDchar0_3 != LCD3HIGH || LCDchar4_5 != LCD3HIGH || LCDchar6_7 != LCD3HIGH)
-  {
-    memcpy_P(buffer,c0, 8);
-    lcd.createChar((byte)0, buffer);                      // digit piece
-    memcpy_P(buffer,c1, 8);
-    lcd.createChar(1, buffer);                      // digit piece
-    memcpy_P(buffer,c2, 8);
-    lcd.createChar(2, buffer);                      // digit piece
-    memcpy_P(buffer,c3, 8);
-    lcd.createChar(3, buffer);                      // digit piece
-    memcpy_P(buffer,c4, 8);
-    lcd.createChar(4, buffer);                      // digit piece
-    memcpy_P(buffer,c5, 8);
-    lcd.createChar(5, buffer);                      // digit piece
-    memcpy_P(buffer,c6, 8);
-    lcd.createChar(6, buffer);                      // digit piece
-    lcd.clear();  // in order to set the LCD back to the proper memory mode after custom characters have been created
-
-    LCDchar0_3 = LCD3HIGH;
-    LCDchar4_5 = LCD3HIGH;
-    LCDchar6_7 = LCD3HIGH;
-
-    #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-        Serial.println(F("loadThreeHighDigits2"));
-    #endif
-  }
+  memcpy_P(buffer,c0, 8);
+  lcd.createChar((byte)0, buffer);                      // digit piece
+  memcpy_P(buffer,c1, 8);
+  lcd.createChar(1, buffer);                      // digit piece
+  memcpy_P(buffer,c2, 8);
+  lcd.createChar(2, buffer);                      // digit piece
+  memcpy_P(buffer,c3, 8);
+  lcd.createChar(3, buffer);                      // digit piece
+  memcpy_P(buffer,c4, 8);
+  lcd.createChar(4, buffer);                      // digit piece
+  memcpy_P(buffer,c5, 8);
+  lcd.createChar(5, buffer);                      // digit piece
+  memcpy_P(buffer,c6, 8);
+  lcd.createChar(6, buffer);                      // digit piece
 
 }
 
@@ -3031,34 +2665,22 @@ byte empty;
 //////////////////////////////////////////////////////////
 void loadGapLessCharacters7A()
 {
-  // same as loadGapLessCharacters7(), except initial test whether loaded previously
-
-  if (LCDchar0_3 != LCDGAPLESS || LCDchar4_5 != LCDGAPLESS || LCDchar6_7 != LCDGAPLESS) // more conditions 31.10.2024
-  {
-    memcpy_P(buffer,g70, 8);
-    lcd.createChar((byte)0, buffer);
-    memcpy_P(buffer,g71, 8);
-    lcd.createChar(1, buffer);
-    memcpy_P(buffer,g72, 8);
-    lcd.createChar(2, buffer);
-    memcpy_P(buffer,g73, 8);
-    lcd.createChar(3, buffer);
-    memcpy_P(buffer,g74, 8);
-    lcd.createChar(4, buffer);
-    memcpy_P(buffer,g75, 8);
-    lcd.createChar(5, buffer);
-    lcd.clear();  // in order to set the LCD back to the proper memory mode after custom characters have been created
-    filled = 2;
-    empty = 3;
-
-    LCDchar0_3 = LCDGAPLESS;
-    LCDchar4_5 = LCDGAPLESS;
-    LCDchar6_7 = LCDGAPLESS;
-
-    #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-      Serial.println(F("loadGapLessCharacters7"));
-    #endif
-  }
+  // same as loadGapLessCharacters7(), bitmaps which are already loaded are skipped by lcd.createChar()
+
+  memcpy_P(buffer,g70, 8);
+  lcd.createChar((byte)0, buffer);
+  memcpy_P(buffer,g71, 8);
+  lcd.createChar(1, buffer);
+  memcpy_P(buffer,g72, 8);
+  lcd.createChar(2, buffer);
+  memcpy_P(buffer,g73, 8);
+  lcd.createChar(3, buffer);
+  memcpy_P(buffer,g74, 8);
+  lcd.createChar(4, buffer);
+  memcpy_P(buffer,g75, 8);
+  lcd.createChar(5, buffer);
+  filled = 2;
+  empty = 3;
 
 }
 
@@ -3482,30 +3104,23 @@ const byte end1[8] PROGMEM = {
 void loadCurvedFramedBarCharactersA() {  // Bar 5, ( xxxx )
   empty = 0;
   filled = 5;
-  if (LCDchar0_3 != LCDFRAMEDBARS || LCDchar4_5 != LCDFRAMEDBARS || LCDchar6_7 != LCDFRAMEDBARS) 
- {
-    memcpy_P(buffer,zeroBar, 8);
-    lcd.createChar(empty, buffer);
-    memcpy_P(buffer,oneBar, 8);
-    lcd.createChar(1, buffer);
-    memcpy_P(buffer,twoBar, 8);
-    lcd.createChar(2, buffer);
-    memcpy_P(buffer,threeBar, 8);
-    lcd.createChar(3, buffer);
-    memcpy_P(buffer,fourBar, 8);
-    lcd.createChar(4, buffer);
-    memcpy_P(buffer,fiveBar, 8);
-    lcd.createChar(filled, buffer);
-
-    memcpy_P(buffer,beg1, 8);
-    lcd.createChar(6, buffer);
-    memcpy_P(buffer,end1, 8);
-    lcd.createChar(7, buffer);
-
-    LCDchar0_3 = LCDFRAMEDBARS; 
-    LCDchar4_5 = LCDFRAMEDBARS;
-    LCDchar6_7 = LCDFRAMEDBARS;
- }
+  memcpy_P(buffer,zeroBar, 8);
+  lcd.createChar(empty, buffer);
+  memcpy_P(buffer,oneBar, 8);
+  lcd.createChar(1, buffer);
+  memcpy_P(buffer,twoBar, 8);
+  lcd.createChar(2, buffer);
+  memcpy_P(buffer,threeBar, 8);
+  lcd.createChar(3, buffer);
+  memcpy_P(buffer,fourBar, 8);
+  lcd.createChar(4, buffer);
+  memcpy_P(buffer,fiveBar, 8);
+  lcd.createChar(filled, buffer);
+
+  memcpy_P(buffer,beg1, 8);
+  lcd.createChar(6, buffer);
+  memcpy_P(buffer,end1, 8);
+  lcd.createChar(7, buffer);
 }
 
 int isSquare (int n) {    //only tested for n < 2459
@@ -0,0 +1,189 @@
+/*
+Holdover: keeps time when the GPS is lost, with the frequency error of the MCU clock learned from PPS     // new 17.10.2026
+
+Without GPS, now() of TimeLib runs on millis(), i.e. with the full frequency error of the crystal or resonator
+of the MCU (the Mega resonator may be off by 1000 ppm or more = 1.4 min/day). And syncTimeGPS() kept setting
+the last time received from the GPS, so the clock could also stop.
+
+While the PPS pulses are good, HoldoverLearn() averages ppsPhase.ppm of clock_pps.h over HOLDOVER_FILTER
+seconds, and once per HOLDOVER_DRIFT_PERIOD finds the drift of this average (aging, not temperature).
+
+HoldoverCheck() is called by syncCheck(). Holdover starts when the time from the GPS is older than
+HOLDOVER_STALE ms, or when no PPS pulse has come for 1 s + PPS_TOLERANCE with PPS on. From the start of
+the last second set by the GPS, new seconds are then counted with micros() and corrected by the learned
+frequency error and drift, and set with setTime() just as syncTimeGPS() would have done.
+Without PPS the start of that second is when it was received from the GPS (ppsPhase.secondMicros, set by
+PpsSync() for a new second only), not the last pass of syncTimeGPS() before HOLDOVER_STALE, which would
+put the clock HOLDOVER_STALE ms back at the start of holdover.
+If PPS pulses come, but no time from the GPS, each pulse starts a new second.
+
+The estimated error grows with the uncertainty of the frequency error: how much ppsPhase.ppm has wandered
+around the average, mostly with temperature, or HOLDOVER_UNKNOWN_PPM if nothing was learned. When the
+GPS comes back, the first PPS pulse gives the actual error. Shown on ScreenHoldover.
+
+HoldoverLearn
+HoldoverPpm
+HoldoverNext
+HoldoverStart
+HoldoverPulse
+HoldoverCheck
+HoldoverError
+*/
+
+#define HOLDOVER_STALE        2500  // ms, time from GPS is older than this: holdover
+#define HOLDOVER_FILTER        600  // s, time constant of average frequency error
+#define HOLDOVER_DRIFT_PERIOD 3600  // s, between estimates of drift
+#define HOLDOVER_UNKNOWN_PPM  1000  // uncertainty without PPS data, Mega resonator
+
+void syncLocalTime();  // forward declaration, GPSClock.ino
+
+struct
+{
+  // learned while PPS is good:
+  float ppm;                  // average frequency error of MCU clock
+  float drift;                // ppm per s
+  float wander;               // ppm, average deviation of ppsPhase.ppm from ppm
+  uint16_t samples;           // no of PPS seconds in average, up to HOLDOVER_FILTER
+  uint16_t driftSeconds;      // into this drift period
+  float driftPpm;             // ppm at start of this drift period
+  // holdover:
+  bool active;
+  time_t anchorTime;          // now() of the second which started at anchorMicros
+  uint32_t anchorMicros;
+  uint32_t nextMicros;        // micros() at start of next second
+  uint32_t seconds;           // since anchor
+  float fraction;             // us not yet added to nextMicros
+  uint32_t startMillis;       // millis() when holdover started
+  uint32_t lastSyncMillis;    // millis() of last time from GPS
+  int32_t lastError;          // us, measured with first PPS pulse after holdover, + = clock was late
+  bool errorMeasured;
+  uint16_t count;             // holdovers since start
+} holdover;
+
+////////////////////////////////////////////////////////////////////////////////
+void HoldoverLearn()  // each good PPS pulse, not in holdover
+{
+  if (ppsPhase.pulses < PPS_FILTER) return;  // ppsPhase.ppm has not settled
+  if (holdover.samples < HOLDOVER_FILTER) holdover.samples++;
+  if (holdover.samples == 1)
+  {
+    holdover.ppm = ppsPhase.ppm;
+    holdover.driftPpm = ppsPhase.ppm;
+    holdover.wander = 0;
+    return;
+  }
+  float deviation = ppsPhase.ppm - holdover.ppm;
+  holdover.ppm += deviation / holdover.samples;
+  holdover.wander += (fabs(deviation) - holdover.wander) / holdover.samples;
+
+  if (++holdover.driftSeconds < HOLDOVER_DRIFT_PERIOD) return;
+  holdover.driftSeconds = 0;
+  float drift = (holdover.ppm - holdover.driftPpm) / HOLDOVER_DRIFT_PERIOD;
+  holdover.drift = (holdover.drift == 0) ? drift : (holdover.drift + drift) / 2;
+  holdover.driftPpm = holdover.ppm;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+float HoldoverPpm()  // frequency error now, with drift since start of holdover
+{
+  return holdover.ppm + holdover.drift * holdover.seconds;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void HoldoverNext()  // nextMicros: start of next second
+{
+  holdover.fraction += HoldoverPpm();  // us per s, + = MCU clock fast: more micros() per second
+  int32_t whole = (int32_t)holdover.fraction;
+  holdover.fraction -= whole;
+  holdover.nextMicros += PPS_NOMINAL + whole;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void HoldoverStart()  // from the second last set by the GPS
+{
+  holdover.active = true;
+  holdover.count++;
+  holdover.startMillis = millis();
+  holdover.anchorTime = ppsPhase.syncTime;
+  holdover.anchorMicros = ppsPhase.secondMicros;
+  holdover.nextMicros = holdover.anchorMicros;
+  holdover.seconds = 0;
+  holdover.fraction = 0;
+  HoldoverNext();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void HoldoverPulse()  // PPS pulse in holdover: error of estimated seconds, and new anchor
+{
+  int32_t offset = (int32_t)(ppsPhase.lastMicros - holdover.nextMicros);  // us after start of next second
+  int32_t second = PPS_NOMINAL + (int32_t)HoldoverPpm();                   // micros() per second
+  uint32_t seconds = holdover.seconds + 1;
+  while (offset >= second / 2)  // a later second, syncCheck() was late
+  {
+    offset -= second;
+    seconds++;
+  }
+  while (offset < -second / 2)  // closer to start of present second
+  {
+    offset += second;
+    seconds--;
+  }
+  holdover.lastError = -offset;  // pulse before estimated start: clock is late
+  holdover.errorMeasured = true;
+
+  holdover.anchorTime += seconds;
+  holdover.anchorMicros = ppsPhase.lastMicros;
+  holdover.nextMicros = holdover.anchorMicros;
+  holdover.seconds = 0;
+  holdover.fraction = 0;
+  HoldoverNext();
+  setTime(holdover.anchorTime);
+  ppsPhase.secondMicros = holdover.anchorMicros;
+  syncLocalTime();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool HoldoverCheck()  // from syncCheck(): true if time is kept here, i.e. syncTimeGPS() should not be used
+{
+  bool pulse = pps && ppsPhase.pulses > 0;  // new pulse, interval within tolerance
+  bool ppsOK = !using_PPS || (ppsPhase.started && micros() - ppsPhase.lastMicros < PPS_NOMINAL + PPS_TOLERANCE);
+  bool gpsOK = gnss.time.isValid() && gnss.time.age() < HOLDOVER_STALE;
+
+  if (gpsOK && ppsOK)
+  {
+    if (holdover.active && pps && using_PPS) HoldoverPulse();  // error at end of holdover
+    holdover.active = false;
+    holdover.lastSyncMillis = millis();
+    if (pulse) HoldoverLearn();
+    return false;
+  }
+  if (timeStatus() == timeNotSet) return false;  // nothing to hold
+
+  if (!holdover.active) HoldoverStart();
+  if (pps && using_PPS)  // PPS, but no time from GPS
+  {
+    HoldoverPulse();
+    return true;
+  }
+
+  if ((int32_t)(micros() - holdover.nextMicros) < 0) return true;  // not yet next second
+  do
+  {
+    holdover.seconds++;
+    ppsPhase.secondMicros = holdover.nextMicros;
+    HoldoverNext();
+  } while ((int32_t)(micros() - holdover.nextMicros) >= 0);  // catch up after a long task
+  setTime(holdover.anchorTime + holdover.seconds);
+  syncLocalTime();
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint32_t HoldoverError()  // us, estimated error since start of holdover
+{
+  float uncertainty = (holdover.samples > 0) ? holdover.wander + ppsPhase.jitter / HOLDOVER_FILTER : HOLDOVER_UNKNOWN_PPM;
+  float error = uncertainty * (millis() - holdover.startMillis) / 1000.0;
+  return (error < 4.0e9) ? (uint32_t)error : 0xFFFFFFFF;
+}
+
+/// THE END ///
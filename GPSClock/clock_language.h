@@ -11,7 +11,7 @@ WordClockNorwegian
 
 #define SV_DE_oe_SMALL   239  // ö, already exists in LCD memory
 
-// The following def's must match those of LCDchar0_3 etc in *.ino file:
+// CGRAM slots of native characters, loaded by loadNativeCharacters():
 #define IS_eth_SMALL     4    // ð 
 #define NO_DA_oe_SMALL   5    // ø
 #define IS_THORN_CAPITAL 5    // þ  
@@ -150,105 +150,60 @@ void loadNativeCharacters(int8_t languageNumber)
 
 //  Norwegian/Danish letters are also used in WordClock, ø: "lørdag, søndag", and Chemical Elements "sølv"
 //  https://forum.arduino.cc/t/error-lcd-16x2/211977/6
+//  17.10.2026: no test whether loaded already, lcd.createChar() skips bitmaps which are in place
 
- if (LCDchar4_5 != LCDNATIVE  || languageNumber != presentLanguageNumber)  //
- {
-    if (strcmp(languages[languageNumber],"nb ") == 0 || strcmp(languages[languageNumber],"da ") == 0 
-                                                     || strcmp(languages[languageNumber],"nn ") == 0)
-    {
-        memcpy_P(buffer,OE_small, 8);
-        lcd.createChar(NO_DA_oe_SMALL, buffer);       // ø: "Lørdag", "Søndag"   
-        LCDchar4_5 = LCDNATIVE;
-        presentLanguageNumber = languageNumber;
-        #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-              Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-              Serial.print(" ");Serial.println(languages[languageNumber]);
-        #endif
-    }
- }
-
- if (LCDchar4_5 != LCDNATIVE || LCDchar6_7 != LCDNATIVE || languageNumber != presentLanguageNumber)  // LCDchar6_7 also 5.11.2024
- {
+  if (strcmp(languages[languageNumber],"nb ") == 0 || strcmp(languages[languageNumber],"da ") == 0 
+                                                   || strcmp(languages[languageNumber],"nn ") == 0)
+  {
+    memcpy_P(buffer,OE_small, 8);
+    lcd.createChar(NO_DA_oe_SMALL, buffer);       // ø: "Lørdag", "Søndag"   
+  }
 
-    if (strcmp(languages[languageNumber],"es ") == 0 || strcmp(languages[languageNumber],"is ") == 0 
-     || strcmp(languages[languageNumber],"non") == 0 || strcmp(languages[languageNumber],"fo ") == 0)
-    {
-        memcpy_P(buffer,a_accent, 8);
-        lcd.createChar(ES_IS_a_ACCENT, buffer);       // á: "Sábado"
-        LCDchar6_7 = LCDNATIVE; // since it fills more than locations 4 and 5 - 30.11.2024
-        #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-          Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-          Serial.print(" ");Serial.println(languages[languageNumber]);
-        #endif 
-    }
+  if (strcmp(languages[languageNumber],"es ") == 0 || strcmp(languages[languageNumber],"is ") == 0 
+    || strcmp(languages[languageNumber],"non") == 0 || strcmp(languages[languageNumber],"fo ") == 0)
+  {
+    memcpy_P(buffer,a_accent, 8);
+    lcd.createChar(ES_IS_a_ACCENT, buffer);       // á: "Sábado"
+  }
 
-    if (strcmp(languages[languageNumber],"sv ") == 0 || strcmp(languages[languageNumber],"nn ") == 0)
-    {
-        // ö exists as char(B11101111) = char(239), no need to create it separately, ä, ü, ñ also
-        memcpy_P(buffer,AA_small, 8);
-        lcd.createChar(SCAND_aa_SMALL, buffer);       //  å: "måndag", Swedish/nynorsk
-        LCDchar6_7 = LCDNATIVE; // since it fills more than locations 4 and 5 - 30.11.2024
-        #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-          Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-          Serial.print(" ");Serial.println(languages[languageNumber]);
-        #endif         
-    }
+  if (strcmp(languages[languageNumber],"sv ") == 0 || strcmp(languages[languageNumber],"nn ") == 0)
+  {
+    // ö exists as char(B11101111) = char(239), no need to create it separately, ä, ü, ñ also
+    memcpy_P(buffer,AA_small, 8);
+    lcd.createChar(SCAND_aa_SMALL, buffer);       //  å: "måndag", Swedish/nynorsk
+  }
 
-    if (strcmp(languages[languageNumber],"es ") == 0)
-    {
-        memcpy_P(buffer,e_accent, 8);                 // é, "Miércoles"
-        lcd.createChar(ES_e_ACCENT, buffer);
-        #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-          Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-          Serial.print(" ");Serial.println(languages[languageNumber]);
-        #endif         
-    }
+  if (strcmp(languages[languageNumber],"es ") == 0)
+  {
+    memcpy_P(buffer,e_accent, 8);                 // é, "Miércoles"
+    lcd.createChar(ES_e_ACCENT, buffer);
+  }
 
-    if (strcmp(languages[languageNumber],"is ") == 0 || strcmp(languages[languageNumber],"non") == 0)
-    {
+  if (strcmp(languages[languageNumber],"is ") == 0 || strcmp(languages[languageNumber],"non") == 0)
+  {
     //  Icelandic, á, ð, Þ, also Old Norse
     //  https://einhugur.com/blog/index.php/xojo-gpio/hd44780-based-lcd-display/
-        memcpy_P(buffer,Thorn, 8);
-        lcd.createChar(IS_THORN_CAPITAL, buffer);
-        memcpy_P(buffer,eth, 8);
-        lcd.createChar(IS_eth_SMALL, buffer);
-  //      LCDchar6_7 = LCDNATIVE; // since it fills more than locations 4 and 5
-        #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-          Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-          Serial.print(" ");Serial.println(languages[languageNumber]);
-        #endif 
-    }
-    if (strcmp(languages[languageNumber],"non") == 0 || strcmp(languages[languageNumber],"fo ") == 0)  // Old Norse, 10.10.2024; Faroese 29.10.2024
-    {   
-        //if (day == Wednesday ... hard to find a suitable variable for weekday which also knows if it is local time or UTC
-        //     memcpy_P(buffer,O_accent, 8);
-        memcpy_P(buffer,o_accent, 8);
-        lcd.createChar(NORSE_o_ACCENT, buffer);
-        LCDchar6_7 = LCDNATIVE; // since it fills more than locations 4 and 5 - 30.11.2024
-        #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-          Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-          Serial.print(" ");Serial.println(languages[languageNumber]);
-        #endif 
-    }   
-
-    if (strcmp(languages[languageNumber],"fo ") == 0)  // Faroese 29.10.2024 
-    {
-        memcpy_P(buffer,y_accent, 8);
-        lcd.createChar(FO_y_ACCENT, buffer);
-
-        memcpy_P(buffer,i_accent, 8);
-        lcd.createChar(FO_i_ACCENT, buffer);
-       // LCDchar6_7 = LCDNATIVE; // since it fills more than locations 4 and 5  
-       #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-          Serial.print(F("loadNativeCharacters: ")); Serial.print(languageNumber); 
-          Serial.print(" ");Serial.println(languages[languageNumber]);
-       #endif 
-    }
-
-    LCDchar4_5 = LCDNATIVE;
-    presentLanguageNumber = languageNumber;
+    memcpy_P(buffer,Thorn, 8);
+    lcd.createChar(IS_THORN_CAPITAL, buffer);
+    memcpy_P(buffer,eth, 8);
+    lcd.createChar(IS_eth_SMALL, buffer);
+  }
+  if (strcmp(languages[languageNumber],"non") == 0 || strcmp(languages[languageNumber],"fo ") == 0)  // Old Norse, 10.10.2024; Faroese 29.10.2024
+  {   
+    //if (day == Wednesday ... hard to find a suitable variable for weekday which also knows if it is local time or UTC
+    //     memcpy_P(buffer,O_accent, 8);
+    memcpy_P(buffer,o_accent, 8);
+    lcd.createChar(NORSE_o_ACCENT, buffer);
+  }   
+
+  if (strcmp(languages[languageNumber],"fo ") == 0)  // Faroese 29.10.2024 
+  {
+    memcpy_P(buffer,y_accent, 8);
+    lcd.createChar(FO_y_ACCENT, buffer);
 
- }
+    memcpy_P(buffer,i_accent, 8);
+    lcd.createChar(FO_i_ACCENT, buffer);
+  }
 }
 
 //////////////////////////
@@ -284,21 +239,11 @@ void loadNorseO(int8_t languageNumber)      // make sure correct Ó (Ódinsdagr)
 void loadAring()   // for use with WordClockNorwegian()
 // New 02.03.2024
 {
-  if (LCDchar6_7 != LCDARING)
-{
-   memcpy_P(buffer,AA_capital, 8);
-   lcd.createChar(SCAND_AA_CAPITAL, buffer); //  Norwegian, Å: "Åtte"
+  memcpy_P(buffer,AA_capital, 8);
+  lcd.createChar(SCAND_AA_CAPITAL, buffer); //  Norwegian, Å: "Åtte"
 
-   memcpy_P(buffer,AA_small, 8);
-   lcd.createChar(SCAND_aa_SMALL, buffer);   //  Norwegian, å: "åtte"
-
-   LCDchar6_7 = LCDARING;
-
-   #ifdef FEATURE_SERIAL_LOAD_CHARACTERS
-     Serial.println(F("loadAring"));
-  #endif
-
-}
+  memcpy_P(buffer,AA_small, 8);
+  lcd.createChar(SCAND_aa_SMALL, buffer);   //  Norwegian, å: "åtte"
 }
 
 
@@ -325,16 +270,11 @@ void WordClockNorwegian()
    */
  
   //  get local time
-  #ifdef FEATURE_DATE_PER_SECOND                                 // for stepping date quickly and check calender function
-    localTime = now() + utcOffset * 60 + dateIteration * SPEED_UP_FACTOR;  // fake local time by stepping up to 1 sec/day
-    dateIteration = dateIteration + 1;
-  #else 
-    localTime = now() + utcOffset * 60;  // the default!
-  #endif
-  if (Twelve24Local > 12) Hour = hour(localTime);
+  localTime = moment.local;  // 17.10.2026: FEATURE_DATE_PER_SECOND steps it in MomentFill()
+  if (Twelve24Local > 12) Hour = moment.localTm.Hour;
   else                    Hour = hourFormat12(localTime);
-  Minute = minute(localTime);
-  Seconds = second(localTime);
+  Minute = moment.localTm.Minute;
+  Seconds = moment.localTm.Second;
 
   lcd.setCursor(0, 0); 
   if (Hour < 10) 
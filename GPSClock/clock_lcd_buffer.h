@@ -0,0 +1,266 @@
+/*
+Shadow framebuffer for the 20x4 LCD, in front of the LCD driver lcdHW        // new 17.10.2026
+
+All screen code writes to lcd as before: setCursor(), print(), write(), clear(), createChar().
+The writes only go to cell[][], the wanted content. shown[][] is what is on the LCD.
+show() sends only the cells that differ. A run of changed cells costs one cursor move and then
+one byte per character. Runs with a single unchanged cell between them are sent as one run, as
+rewriting that cell costs the same as a cursor move.
+
+show() is called by the scheduler after each task (RunTask, but not for tasks run from TaskYield(), i.e. 
+in the middle of a screen) and by updateDisplay(), and must be called before delay() if something has 
+to be seen during the delay.
+
+With hold() the buffer is not sent after each task, and the LCD keeps showing the old content
+until show() is called. This is used by updateDisplay() in order to render the screen for
+second N+1 during the idle part of second N, and to flip it to the LCD on the PPS pulse.
+
+Characters beyond column 19 follow the DDRAM addresses of the HD44780: line 0 continues on line 2,
+line 1 on line 3, and what is beyond line 2 and 3 is not visible.
+
+clear() only clears the buffer, so there is no slow clear command and no flicker when changing
+screens: the new screen overwrites the old one, and only the cells which differ are sent.
+
+Custom characters (createChar) are loaded directly to the LCD, after which the cursor is set
+again, so the LCD is back in DDRAM (display) addressing without a clear. During hold() they are only
+kept in slotBitmap[] and marked pending, and loaded at the start of show(): a screen rendered ahead
+must not change the custom characters of the one still on the LCD.
+The bitmap in each of the 8 CGRAM slots is known, so a bitmap which is already in its slot is not 
+sent again. Loaders such as loadArrowCharacters() can therefore be called for every update of a screen.
+glyph() finds the slot of a bitmap in PROGMEM, or loads it into the least recently used slot, i.e. not one
+which has been loaded or asked for in the same screen update as long as there is another one. It is only used
+for the å of Reminder(). All other custom characters still have fixed slots (UP_ARROW, AM_PM, the segments
+of the big digit fonts, the letters of clock_language.h, ...), which the screen's loaders fill in on each
+update, so a slot taken over by another screen is loaded again when it is needed.
+
+bytesSent counts bytes sent to the HD44780, commands + characters, i.e. bus traffic.
+
+printFrame() writes the content of the LCD as 4 lines of text, e.g. to the serial port. Custom
+characters are shown as '#' and other characters outside of ASCII as '*'. 
+With FEATURE_SERIAL_FRAMES in clock_debug.h every new second is written this way by updateDisplay(), so 
+screens can be checked and compared with earlier captures on a PC without looking at the LCD.
+
+LcdBuffer::begin
+LcdBuffer::clear
+LcdBuffer::setCursor
+LcdBuffer::write
+LcdBuffer::createChar
+LcdBuffer::upload
+LcdBuffer::glyph
+LcdBuffer::hold
+LcdBuffer::release
+LcdBuffer::show
+LcdBuffer::printFrame
+*/
+
+class LcdBuffer : public Print
+{
+  public:
+    void begin(uint8_t cols, uint8_t rows);
+    void clear();
+    void setCursor(uint8_t newCol, uint8_t newRow);
+    size_t write(uint8_t c);
+    using Print::write;
+    void createChar(uint8_t location, const uint8_t charmap[]);
+    uint8_t glyph(const uint8_t *bitmapP);  // slot of PROGMEM bitmap, loaded if not there
+    void cursor() { lcdHW.cursor(); }
+    void hold() { holding = true; }      // buffer is only sent by show()
+    void release() { holding = false; }  // buffer is sent after each task again
+    uint16_t show();                     // changed cells -> LCD, returns no of bytes sent, ends hold()
+    void printFrame(Print &out);         // LCD content as text
+    bool holding = false;
+    uint32_t bytesSent = 0;
+
+  private:
+    uint8_t cell[NROWS][NCOLS];   // wanted content
+    uint8_t shown[NROWS][NCOLS];  // content of LCD
+    bool dirty = false;           // cell[][] != shown[][] somewhere
+    uint8_t col = 0;              // cursor of screen code
+    uint8_t row = 0;
+    uint8_t hwCol = 0;            // cursor of LCD
+    uint8_t hwRow = 0;
+    bool hwValid = false;         // hwCol, hwRow known
+    uint8_t slotBitmap[8][8];     // custom character in each CGRAM slot
+    uint16_t slotUsed[8];         // glyphClock when slot was last asked for
+    uint8_t slotValid = 0;        // bit i set: slotBitmap[i] is on LCD, or pending
+    uint8_t slotPending = 0;      // bit i set: slotBitmap[i] is loaded by next show(), set during hold()
+    uint16_t glyphClock = 0;
+    void upload(uint8_t location);  // slotBitmap[location] -> CGRAM of LCD
+};
+
+////////////////////////////////////////////////////////////////////////////////
+void LcdBuffer::begin(uint8_t cols, uint8_t rows)
+{
+  lcdHW.begin(cols, rows);
+  lcdHW.clear();
+  memset(cell, ' ', sizeof(cell));
+  memset(shown, ' ', sizeof(shown));
+  col = row = 0;
+  hwCol = hwRow = 0;
+  hwValid = true;
+  dirty = false;
+  slotValid = 0;
+  slotPending = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LcdBuffer::clear()  // buffer only, blank cells of LCD are sent by show()
+{
+  memset(cell, ' ', sizeof(cell));
+  col = 0;
+  row = 0;
+  dirty = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LcdBuffer::setCursor(uint8_t newCol, uint8_t newRow)
+{
+  col = newCol;
+  row = newRow % NROWS;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+size_t LcdBuffer::write(uint8_t c)
+{
+  if (col >= NCOLS && row < 2)  // line 0 -> 2, 1 -> 3 as in DDRAM of HD44780
+  {
+    col = 0;
+    row += 2;
+  }
+  if (col < NCOLS && cell[row][col] != c)  // beyond line 2 and 3: not visible
+  {
+    cell[row][col] = c;
+    dirty = true;
+  }
+  col++;
+  return 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LcdBuffer::createChar(uint8_t location, const uint8_t charmap[])
+{
+  location &= 7;
+  slotUsed[location] = ++glyphClock;
+  if ((slotValid & (1 << location)) && memcmp(slotBitmap[location], charmap, 8) == 0) return;  // already there
+
+  memcpy(slotBitmap[location], charmap, 8);
+  slotValid |= 1 << location;
+  if (holding)  // LCD still shows the previous screen, which may use the old bitmap
+  {
+    slotPending |= 1 << location;
+    return;
+  }
+  upload(location);
+  bytesSent += 10;  // set CGRAM address + 8 rows + set DDRAM address
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LcdBuffer::upload(uint8_t location)
+{
+#ifdef FEATURE_SERIAL_LOAD_CHARACTERS
+  Serial.print(F("createChar ")); Serial.println(location);
+#endif
+  lcdHW.createChar(location, slotBitmap[location]);
+  lcdHW.setCursor(hwCol < NCOLS ? hwCol : 0, hwRow);  // back to DDRAM addressing
+  if (hwCol >= NCOLS) hwCol = 0;
+  hwValid = true;
+  slotPending &= ~(1 << location);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint8_t LcdBuffer::glyph(const uint8_t *bitmapP)
+{
+  uint8_t bitmap[8];
+  memcpy_P(bitmap, bitmapP, 8);
+
+  byte oldest = 0;
+  uint16_t oldestAge = 0;
+  for (byte i = 0; i < 8; i++)
+  {
+    if ((slotValid & (1 << i)) && memcmp(slotBitmap[i], bitmap, 8) == 0)
+    {
+      slotUsed[i] = ++glyphClock;
+      return i;
+    }
+    uint16_t age = (slotValid & (1 << i)) ? glyphClock - slotUsed[i] : 0xFFFF;  // empty slot first
+    if (age > oldestAge)
+    {
+      oldest = i;
+      oldestAge = age;
+    }
+  }
+  createChar(oldest, bitmap);
+  return oldest;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t LcdBuffer::show()
+{
+  holding = false;
+  uint16_t sent = 0;
+  for (byte i = 0; slotPending != 0 && i < 8; i++)  // custom characters loaded during hold()
+    if (slotPending & (1 << i))
+    {
+      upload(i);
+      sent += 10;
+    }
+  if (!dirty)
+  {
+    bytesSent += sent;
+    return sent;
+  }
+
+  for (byte r = 0; r < NROWS; r++)
+  {
+    byte c = 0;
+    while (c < NCOLS)
+    {
+      if (cell[r][c] == shown[r][c])
+      {
+        c++;
+        continue;
+      }
+      byte end = c + 1;  // run of changed cells is c ... end-1
+      for (byte k = c + 1; k < NCOLS && k <= end + 1; k++)  // bridge a single unchanged cell
+        if (cell[r][k] != shown[r][k]) end = k + 1;
+
+      if (!hwValid || hwRow != r || hwCol != c)
+      {
+        lcdHW.setCursor(c, r);
+        sent++;
+      }
+      for (byte k = c; k < end; k++)
+      {
+        lcdHW.write(cell[r][k]);
+        shown[r][k] = cell[r][k];
+        sent++;
+      }
+      hwRow = r;
+      hwCol = end;
+      hwValid = true;
+      c = end;
+    }
+  }
+  dirty = false;
+  bytesSent += sent;
+  return sent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void LcdBuffer::printFrame(Print &out)
+{
+  for (byte r = 0; r < NROWS; r++)
+  {
+    out.print('|');
+    for (byte c = 0; c < NCOLS; c++)
+    {
+      uint8_t ch = shown[r][c];
+      if (ch < 8)         out.print('#');  // custom character
+      else if (ch >= 128) out.print('*');  // LCD ROM, e.g. DEGREE, DOT, ALL_ON
+      else                out.print((char)ch);
+    }
+    out.println('|');
+  }
+}
+
+/// THE END ///
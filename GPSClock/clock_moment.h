@@ -0,0 +1,61 @@
+/*
+Time of the frame being drawn, broken down once, for all screens     // new 17.10.2026
+
+Screens called hour(now()), minute(now()), ..., year(now()) and the same for localTime one at a time.
+TimeLib keeps the broken-down time of the last time_t it was given only, so each change between UTC
+and local time, e.g. in Sidereal() or PlanetVisibility(), meant another breakTime(), which is a loop
+over years and months.
+
+MomentFill() is called by DrawScreen() before the screen, i.e. once per second, also for a screen which
+is rendered ahead, and breaks down UTC and local time once. Screens read moment.* instead.
+Local time is now() + utcOffset, as the screens which set localTime = now() + utcOffset * 60 themselves.
+Day of year and ISO week of the local date are only found again when the local date changes.
+
+Julian Day as in get_julian_date() of clock_z_planets.h: jd at 0 h UTC (x.5) + jdFrac, the fraction of
+the UTC day. Both are exact in float, unlike now() / 86400.0 + 2440587.5
+
+MomentFill
+*/
+
+#define JD_1970 2440587.5  // Julian Day at 1.1.1970 0 h UTC
+
+struct
+{
+  time_t utc;              // now()
+  time_t local;            // localTime
+  tmElements_t utcTm;      // Second, Minute, Hour, Wday (1 = Sunday), Day, Month, Year (since 1970: tmYearToCalendar())
+  tmElements_t localTm;
+  int dayOfYear;           // local, 1 = 1 January
+  byte isoWeek;            // local, 1 ... 53
+  float jd;                // Julian Day at 0 h UTC
+  float jdFrac;            // of UTC day
+  time_t localDays;        // elapsedDays(local) of dayOfYear, isoWeek
+} moment;
+
+////////////////////////////////////////////////////////////////////////////////
+void MomentFill()  // from DrawScreen(), for now()
+{
+  time_t t = now();
+  if (t == moment.utc && t + utcOffset * 60L == moment.local) return;  // same second, e.g. a screen drawn again after the menu
+  moment.utc = t;
+  moment.local = t + utcOffset * 60L;
+#ifdef FEATURE_DATE_PER_SECOND  // for stepping date quickly and check calender function, was in the screens
+  moment.local += dateIteration * SPEED_UP_FACTOR;  // fake local time by stepping up to 1 sec/day
+  dateIteration = dateIteration + 1;
+#endif
+  breakTime(moment.utc, moment.utcTm);
+  breakTime(moment.local, moment.localTm);
+
+  moment.jd = JD_1970 + elapsedDays(moment.utc);
+  moment.jdFrac = elapsedSecsToday(moment.utc) / (float)SECS_PER_DAY;
+
+  if (elapsedDays(moment.local) == moment.localDays) return;  // same local date
+  moment.localDays = elapsedDays(moment.local);
+  tmElements_t tm = {0, 0, 0, 0, 1, 1, moment.localTm.Year};  // 1 January
+  moment.dayOfYear = moment.localDays - elapsedDays(makeTime(tm)) + 1;
+  GregorianDate a(moment.localTm.Month, moment.localTm.Day, tmYearToCalendar(moment.localTm.Year));
+  IsoDate ISO(a);
+  moment.isoWeek = ISO.GetWeek();
+}
+
+/// THE END ///
@@ -0,0 +1,259 @@
+/*
+Streaming NMEA field extractor, fed the same characters as gps.encode() in readGPS()    // new 17.10.2026
+
+Replaces the TinyGPSCustom objects for GSV, GSA and RMC fields. TinyGPS++ compares every field of every
+sentence with its whole list of custom fields, and each of them keeps a string copy which was then
+converted with atoi() in GPSParse() and GPSInfo().
+Here the talker + sentence ID in field 0 is looked up once per sentence, other sentences are skipped.
+Numbers are accumulated while the characters arrive, and written to sats[] and nmea.* when the
+checksum is OK:
+
+  $xxGSV: satellites in view per constellation (GP, GL, GA, GB/BD), and
+          message no, no of messages, PRN, elevation, azimuth, SNR of up to 4 satellites -> sats[], clock_satellites.h
+          nmea.gsvCycle is set after the last message of a complete cycle, for GPSParse()
+  $GPGSA, $GNGSA: field 2, mode 1-none, 2=2D, 3=3D
+  $GPRMC, $GNRMC: field 2, position status A = data valid, V = data invalid
+
+TinyGPS++ is still used for time, date, position, no of satellites in fix and hdop.
+
+NmeaTalker
+NmeaEndField
+NmeaCommit
+NmeaEncode
+*/
+
+#define NMEA_GP 0        // index of nmea.inView[]
+#define NMEA_GL 1
+#define NMEA_GA 2
+#define NMEA_GB 3
+#define NMEA_SYSTEMS 4   // constellations with satellites in view
+#define NMEA_GN 4        // combined GNSS, only in GSA and RMC
+#define NMEA_NONE 255
+
+#define NMEA_OTHER 0     // sentence types
+#define NMEA_GSV   1
+#define NMEA_GSA   2
+#define NMEA_RMC   3
+
+#define NMEA_MAX_FIELD 24  // longer sentences are ignored after this field
+
+void SatCycle(byte system, byte number, byte total);                                // forward declaration, clock_satellites.h
+void SatUpdate(byte system, byte prn, byte elevation, uint16_t azimuth, byte snr);  // forward declaration
+bool SatCycleEnd(byte system, byte number, byte total);                             // forward declaration
+
+const byte nmeaPrimarySignal[NMEA_SYSTEMS] = {1, 1, 7, 1};  // NMEA 4.10 signal ID: GPS L1 C/A, GLONASS G1 C/A, Galileo E1, BeiDou B1I
+
+struct
+{
+  byte inView[NMEA_SYSTEMS];  // satellites in view, from $xxGSV
+  byte gsvTotal;              // $GPGSV: no of messages in this cycle, 0 = none received yet
+  byte gsvNumber;             // $GPGSV: message no
+  bool gsvCycle;              // last $xxGSV of a complete cycle received, cleared by GPSParse()
+  char gpsMode;               // $GPGSA: '1', '2', '3', or 0 if not received
+  char gnssMode;              // $GNGSA
+  char gpsStatus;             // $GPRMC: 'A' or 'V', or 0 if not received
+  char gnssStatus;            // $GNRMC
+} nmea;
+
+// state of sentence being received:
+bool nmeaActive = false;     // between '$' and checksum
+bool nmeaInChecksum = false;
+byte nmeaField;              // field no, 0 = talker + sentence ID
+byte nmeaIdLength;
+char nmeaId[5];              // talker + sentence ID, e.g. "GPGSV"
+byte nmeaTalker;             // NMEA_GP ...
+byte nmeaType;               // NMEA_GSV ...
+uint16_t nmeaValue;          // number in present field
+char nmeaFirst;              // first character of present field, 0 if empty
+byte nmeaSum;                // XOR of characters between '$' and '*'
+byte nmeaSumReceived;
+byte nmeaSumDigits;
+
+// fields of sentence, written to nmea.* and sats[] if checksum is OK:
+byte nmeaTotal, nmeaNumber, nmeaInView;
+char nmeaModeStatus;
+byte nmeaSatCount;           // complete satellites in this $xxGSV
+byte nmeaSignal;             // signal ID after last satellite, 0 if none
+struct
+{
+  byte prn;
+  byte elevation;
+  uint16_t azimuth;
+  byte snr;
+} nmeaSat[4];
+
+////////////////////////////////////////////////////////////////////////////////
+byte NmeaTalker(char a, char b)  // NMEA_GP ... from the 2 characters of talker ID
+{
+  if (a == 'G')
+  {
+    if (b == 'P') return NMEA_GP;
+    if (b == 'L') return NMEA_GL;
+    if (b == 'A') return NMEA_GA;
+    if (b == 'B') return NMEA_GB;
+    if (b == 'N') return NMEA_GN;
+  }
+  else if (a == 'B' && b == 'D') return NMEA_GB;  // older BeiDou talker ID
+  return NMEA_NONE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void NmeaEndField(char c)  // a field has ended with c = ',' or '*'
+{
+  if (nmeaField == 0)  // dispatch once per sentence
+  {
+    LinkSentence(nmeaId, nmeaIdLength);  // sentences/s per type, clock_gpslink.h
+    nmeaType = NMEA_OTHER;
+    nmeaTalker = (nmeaIdLength == 5) ? NmeaTalker(nmeaId[0], nmeaId[1]) : NMEA_NONE;
+    if (nmeaTalker != NMEA_NONE)
+    {
+      if (nmeaId[2] == 'G' && nmeaId[3] == 'S' && nmeaId[4] == 'V' && nmeaTalker != NMEA_GN) nmeaType = NMEA_GSV;
+      else if (nmeaId[2] == 'G' && nmeaId[3] == 'S' && nmeaId[4] == 'A')                     nmeaType = NMEA_GSA;
+      else if (nmeaId[2] == 'R' && nmeaId[3] == 'M' && nmeaId[4] == 'C')                     nmeaType = NMEA_RMC;
+      if (nmeaType != NMEA_GSV && nmeaTalker != NMEA_GP && nmeaTalker != NMEA_GN) nmeaType = NMEA_OTHER;
+    }
+    nmeaSatCount = 0;
+    nmeaSignal = 0;
+    nmeaModeStatus = 0;
+    return;
+  }
+
+  switch (nmeaType)
+  {
+    case NMEA_GSV:
+      if      (nmeaField == 1) nmeaTotal = nmeaValue;
+      else if (nmeaField == 2) nmeaNumber = nmeaValue;
+      else if (nmeaField == 3) nmeaInView = nmeaValue;
+      else if (c == '*' && (nmeaField - 4) % 4 == 0) nmeaSignal = nmeaValue;  // NMEA 4.10
+      else if (nmeaField < 20)  // 4 satellites with 4 fields each
+      {
+        byte i = (nmeaField - 4) / 4;
+        switch ((nmeaField - 4) % 4)
+        {
+          case 0: nmeaSat[i].prn = nmeaValue; break;
+          case 1: nmeaSat[i].elevation = nmeaValue; break;
+          case 2: nmeaSat[i].azimuth = nmeaValue; break;
+          case 3:
+            nmeaSat[i].snr = nmeaValue;  // empty = 0 when not tracking
+            nmeaSatCount = i + 1;        // not before all 4 fields, NMEA 4.1 has a signal ID after the last one
+            break;
+        }
+      }
+      break;
+
+    case NMEA_GSA:
+    case NMEA_RMC:
+      if (nmeaField == 2) nmeaModeStatus = nmeaFirst;
+      break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void NmeaCommit()  // sentence with correct checksum: fields -> nmea.*, sats[]
+{
+  switch (nmeaType)
+  {
+    case NMEA_GSV:
+      if (nmeaSignal != 0 && nmeaSignal != nmeaPrimarySignal[nmeaTalker]) break;  // other signal of same satellites
+      nmea.inView[nmeaTalker] = nmeaInView;
+      if (nmeaTalker == NMEA_GP)
+      {
+        nmea.gsvTotal = nmeaTotal;
+        nmea.gsvNumber = nmeaNumber;
+      }
+
+      SatCycle(nmeaTalker, nmeaNumber, nmeaTotal);
+      for (byte i = 0; i < nmeaSatCount; i++)
+        SatUpdate(nmeaTalker, nmeaSat[i].prn, nmeaSat[i].elevation, nmeaSat[i].azimuth, nmeaSat[i].snr);
+      if (SatCycleEnd(nmeaTalker, nmeaNumber, nmeaTotal)) nmea.gsvCycle = true;
+      break;
+
+    case NMEA_GSA:
+      if (nmeaTalker == NMEA_GP) nmea.gpsMode = nmeaModeStatus;
+      else                       nmea.gnssMode = nmeaModeStatus;
+      break;
+
+    case NMEA_RMC:
+      if (nmeaTalker == NMEA_GP) nmea.gpsStatus = nmeaModeStatus;
+      else                       nmea.gnssStatus = nmeaModeStatus;
+      break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void NmeaEncode(char c)  // one character from GPS
+{
+  if (c == '$')  // start of sentence, also after an incomplete one
+  {
+    nmeaActive = true;
+    nmeaInChecksum = false;
+    nmeaField = 0;
+    nmeaIdLength = 0;
+    nmeaValue = 0;
+    nmeaFirst = 0;
+    nmeaSum = 0;
+    return;
+  }
+  if (!nmeaActive) return;
+
+  if (nmeaInChecksum)
+  {
+    byte digit;
+    if (c >= '0' && c <= '9')      digit = c - '0';
+    else if (c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+    else
+    {
+      nmeaActive = false;
+      return;
+    }
+    nmeaSumReceived = (nmeaSumReceived << 4) | digit;
+    if (++nmeaSumDigits == 2)
+    {
+      nmeaActive = false;
+      if (nmeaSumReceived == nmeaSum) NmeaCommit();
+    }
+    return;
+  }
+
+  if (c == '*' || c == ',')
+  {
+    NmeaEndField(c);
+    if (nmeaType == NMEA_OTHER)  // not used here: skip rest of sentence
+    {
+      nmeaActive = false;
+      return;
+    }
+    if (c == '*')
+    {
+      nmeaInChecksum = true;
+      nmeaSumReceived = 0;
+      nmeaSumDigits = 0;
+      return;
+    }
+    nmeaSum ^= c;
+    if (++nmeaField > NMEA_MAX_FIELD) nmeaActive = false;
+    nmeaValue = 0;
+    nmeaFirst = 0;
+    return;
+  }
+
+  if (c == '\r' || c == '\n')  // end of sentence without checksum: ignored
+  {
+    nmeaActive = false;
+    return;
+  }
+
+  nmeaSum ^= c;
+  if (nmeaField == 0)
+  {
+    if (nmeaIdLength < sizeof(nmeaId)) nmeaId[nmeaIdLength] = c;
+    nmeaIdLength++;
+  }
+  else
+  {
+    if (nmeaFirst == 0) nmeaFirst = c;
+    if (c >= '0' && c <= '9') nmeaValue = 10 * nmeaValue + (c - '0');
+  }
+}
+
+/// THE END ///
@@ -17,6 +17,7 @@
 #define COLDSTART_demoStepType      0     // step type in demo (0: increase +, 1: decrease -, 2: random)
 #define COLDSTART_firstDayWeek      2     // 1 for Sunday, 2 for Monday; range 1...7
 #define COLDSTART_Twelve24Local    24     // 24 hrs clock for local time, alternative 12
+#define COLDSTART_gpsProtocol       0     // 0: NMEA, 1: u-blox UBX binary, see clock_ubx.h. 1 needs GPS_CONFIG_UBLOX
 
 
 // The following #defines should normally all be commented out:
@@ -77,9 +78,12 @@ Menu_type menuStruct[] =
       ScreenChemical, 
       // status
       ScreenCodeStatus, ScreenInternalTime, 
+      #ifdef FEATURE_PERF
+         ScreenPerf,
+      #endif
       // radio amateur
       ScreenNCDXFBeacons1, ScreenNCDXFBeacons2, ScreenWSPRsequence, 
-      ScreenSidereal, ScreenGPSInfo, ScreenBigNumbers2, ScreenBigNumbers2UTC, 
+      ScreenSidereal, ScreenGPSInfo, ScreenGPSLink, ScreenPPS, ScreenHoldover, ScreenBigNumbers2, ScreenBigNumbers2UTC, 
       ScreenBigNumbers3, ScreenBigNumbers3UTC, 
       #ifndef ARDUINO_SAMD_VARIANT_COMPLIANCE
          ScreenReminder,
@@ -137,7 +141,11 @@ Menu_type menuStruct[] =
 #ifdef TESTSCREENS
   ,
   {"Test     ", 
-      ScreenLocalUTCWeek, ScreenGPSInfo, ScreenFactorization, ScreenProgress, ScreenDemoClock,
+      ScreenLocalUTCWeek, ScreenGPSInfo, ScreenGPSLink, ScreenPPS, ScreenHoldover, ScreenFactorization, ScreenProgress, 
+      #ifdef FEATURE_PERF
+         ScreenPerf,
+      #endif
+      ScreenDemoClock,
       -1}
 #endif 
 };
@@ -207,8 +215,10 @@ const char myDays[][7][12] PROGMEM = {
 
 // *** 1D. Time zones ****************************************************************************
 
-// select time zone for display in Screen# "ScreenTimeZones". Points to array of time zones defined in clock_zone.h
-int userTimeZones[4] = {16, 17, 3, 7};  // user selectable - point to time zone in clock_custom_routines.h 
+// select time zone for display in Screen# "ScreenTimeZones". Points to array of time zones defined in clock_timezone.h
+// 17.10.2026: only for cold start, the list is set in secondary menu "i. World clock" and kept in EEPROM.
+// Up to 16 zones, 4 per page, see clock_worldclock.h
+byte userTimeZones[] = {16, 17, 3, 7};  // user selectable - point to time zone in clock_timezone.h 
                                         // make sure to put time zones with 4-letter designations in positions 1 or 3 if needed
 
 #define AUTO_UTC_OFFSET
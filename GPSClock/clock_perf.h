@@ -0,0 +1,182 @@
+/*
+Execution time statistics, with FEATURE_PERF in clock_debug.h     // new 17.10.2026
+
+One stage per task of the scheduler (readGPS, encoder, sync, GPSParse, display, ...), measured in RunTask(),
+one stage per screen, measured in ScreenSelect(), and the time from the PPS pulse until the screen
+rendered ahead has been sent to the LCD, measured in updateDisplay().
+Per stage: no of runs, min/average/max execution time [us], and a coarse log2 histogram with
+bins 2 octaves wide:
+   bin    0      1      2      3       4       5        6       7
+   us   <256   <1024  <4096  <16384  <65536  <262144  <1.05 s  longer
+
+For each screen also the average no of bytes sent to the LCD per second (commands + characters),
+measured in updateDisplay(), for checking the effect of the shadow framebuffer in clock_lcd_buffer.h.
+
+Render ahead should give exactly one DrawScreen() per second. perfDrawRepeats counts seconds which were
+drawn again, perfDrawSkips seconds which were not drawn at all (slow screen, time jump), not counting a new
+screen or a closed menu.
+
+Screen times include readGPS run from TaskYield() in the middle of the screen, and DemoClock
+includes the screen it shows.
+
+Shown on ScreenPerf, one stage at a time.
+Dumped on the serial port (115200 bps) when 'p' is received, reset with 'r'. 'f' prints the LCD content.
+Uses about 1.4 kB RAM, so it is off by default on the Mega.
+
+PerfBin
+PerfAdd
+PerfReset
+PerfScreenStage
+PerfLcdBytes
+PerfStageName
+PerfPrintMicros
+PerfDump
+PerfSerialPoll
+*/
+
+#define PERF_BINS 8
+
+typedef struct
+{
+  uint16_t count;       // saturates at 65535
+  uint32_t minMicros;
+  uint32_t avgMicros;   // running average over ~16 runs
+  uint32_t maxMicros;
+  uint8_t  hist[PERF_BINS];  // halved when a bin is full, i.e. weighted towards recent runs
+} perf_type;
+
+#define PERF_SCREEN0 noOfTasks                  // stage of screen 0, tasks first
+#define PERF_PPS_LCD (noOfTasks + noOfScreens)  // PPS pulse -> last byte on LCD
+#define NO_OF_PERF_STAGES (noOfTasks + noOfScreens + 1)
+
+perf_type perf[NO_OF_PERF_STAGES];
+uint16_t perfLcdBytes[noOfScreens];  // running average x 16 of bytes sent to LCD per second, per screen
+uint16_t perfDrawRepeats = 0;        // DrawScreen() for a second which has been drawn already
+uint16_t perfDrawSkips = 0;          // DrawScreen() more than one second after the last one
+
+////////////////////////////////////////////////////////////////////////////////
+byte PerfBin(uint32_t usedMicros)
+{
+  byte log2 = 0;
+  while (usedMicros >>= 1) log2++;
+  if (log2 < 8) return 0;
+  log2 = (log2 - 6) / 2;
+  return (log2 < PERF_BINS) ? log2 : PERF_BINS - 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfAdd(byte stage, uint32_t usedMicros)
+{
+  if (stage >= NO_OF_PERF_STAGES) return;
+  perf_type *p = &perf[stage];
+
+  if (p->count == 0)
+  {
+    p->minMicros = usedMicros;
+    p->avgMicros = usedMicros;
+    p->maxMicros = usedMicros;
+  }
+  else
+  {
+    if (usedMicros < p->minMicros) p->minMicros = usedMicros;
+    if (usedMicros > p->maxMicros) p->maxMicros = usedMicros;
+    p->avgMicros = p->avgMicros - p->avgMicros / 16 + usedMicros / 16;
+  }
+  if (p->count < 0xFFFF) p->count++;
+
+  byte bin = PerfBin(usedMicros);
+  if (p->hist[bin] == 0xFF)
+    for (byte k = 0; k < PERF_BINS; k++) p->hist[k] >>= 1;
+  p->hist[bin]++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfReset()
+{
+  memset(perf, 0, sizeof(perf));
+  memset(perfLcdBytes, 0, sizeof(perfLcdBytes));
+  perfDrawRepeats = 0;
+  perfDrawSkips = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+byte PerfScreenStage(int disp)  // stage for menu position disp
+{
+  if (disp < 0 || disp >= noOfScreens || menuScreen[disp] >= noOfScreens) return NO_OF_PERF_STAGES;  // not in menu: not measured
+  return PERF_SCREEN0 + menuScreen[disp];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfLcdBytes(int disp, uint16_t sent)  // bytes sent to LCD for one second of screen at menu position disp
+{
+  byte stage = PerfScreenStage(disp);
+  if (stage >= PERF_PPS_LCD) return;
+  uint16_t *avg = &perfLcdBytes[stage - PERF_SCREEN0];
+  if (*avg == 0) *avg = 16 * sent;
+  else           *avg = *avg - *avg / 16 + sent;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfStageName(byte stage)  // 9 characters in textBuffer
+{
+  if (stage < PERF_SCREEN0)       sprintf(textBuffer, "%-9s", tasks[stage].name);
+  else if (stage < PERF_PPS_LCD)  sprintf(textBuffer, "screen %2d", stage - PERF_SCREEN0);
+  else                            strcpy(textBuffer, "PPS->LCD ");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfPrintMicros(Print &out, uint32_t usedMicros)  // 6 characters: "1234us", "1234ms", "  12s "
+{
+  if (usedMicros < 10000UL)          sprintf(textBuffer, "%4luus", (unsigned long)usedMicros);
+  else if (usedMicros < 10000000UL)  sprintf(textBuffer, "%4lums", (unsigned long)(usedMicros / 1000));
+  else                               sprintf(textBuffer, "%4lus ", (unsigned long)(usedMicros / 1000000));
+  out.print(textBuffer);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfDump()
+{
+  Serial.println(F("Stage       runs  min[us]  avg[us]  max[us]  <256 <1k <4k <16k <65k <262k <1s >1s  LCD[bytes/s]"));
+  for (byte i = 0; i < NO_OF_PERF_STAGES; i++)
+  {
+    if (perf[i].count == 0) continue;
+    PerfStageName(i);
+    Serial.print(textBuffer);
+    Serial.print(F(" ")); Serial.print(perf[i].count);
+    Serial.print(F(" ")); Serial.print(perf[i].minMicros);
+    Serial.print(F(" ")); Serial.print(perf[i].avgMicros);
+    Serial.print(F(" ")); Serial.print(perf[i].maxMicros);
+    Serial.print(F(" "));
+    for (byte k = 0; k < PERF_BINS; k++)
+    {
+      Serial.print(F(" ")); Serial.print(perf[i].hist[k]);
+    }
+    if (i >= PERF_SCREEN0 && i < PERF_PPS_LCD)
+    {
+      Serial.print(F("  ")); Serial.print(perfLcdBytes[i - PERF_SCREEN0] / 16);
+    }
+    Serial.println();
+  }
+  Serial.print(F("Seconds drawn twice: ")); Serial.print(perfDrawRepeats);
+  Serial.print(F(", not drawn: ")); Serial.println(perfDrawSkips);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PerfSerialPoll()  // task: 'p' = dump, 'r' = reset, 'f' = LCD frame
+{
+#ifndef FEATURE_FAKE_SERIAL_GPS_IN  // otherwise Serial carries GPS data
+  while (Serial.available())
+  {
+    char c = Serial.read();
+    if (c == 'p') PerfDump();
+    else if (c == 'f') lcd.printFrame(Serial);
+    else if (c == 'r')
+    {
+      PerfReset();
+      Serial.println(F("Perf reset"));
+    }
+  }
+#endif
+}
+
+/// THE END ///
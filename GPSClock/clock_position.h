@@ -0,0 +1,91 @@
+/*
+Position snapshot: one place where the position from the GPS is read     // new 17.10.2026
+
+Earlier each screen read gnss.location.lat()/lng() (or latitude_manual, longitude_manual with
+DEBUG_MANUAL_POSITION) into latitude, lon by itself, often every second, and nothing could tell if the
+position had changed. Here PositionUpdate(), called once per second from GPSParse(), keeps a filtered copy
+in position.*. It only moves when the new position is more than POSITION_MOVE m away from the published one,
+or when the quality of the fix changes, and then position.version is incremented.
+
+Screens call PositionGet() to set latitude, lon, alt from the snapshot, and results which depend on the
+position only (i.e. not on time) may be kept until PositionChanged() says otherwise, e.g. the locator in
+LcdUTCTimeLocator().
+
+Quality: 0 = no fix, else the fix mode of $xxGSA (or NAV-PVT): '1' no fix, '2' 2D, '3' 3D
+
+PositionQuality
+PositionUpdate
+PositionGet
+PositionChanged
+*/
+
+#define POSITION_MOVE 100.0   // m, smaller moves, e.g. GPS noise, don't give a new position.version
+#define METERS_PER_DEGREE 111195.0  // along a meridian, earth radius 6371 km
+
+struct
+{
+  double lat, lon;   // degrees, published position
+  float alt;         // m, follows the GPS every second, doesn't change version
+  bool valid;        // a position has been received, as gnss.location.isValid()
+  char quality;      // of fix when published
+  uint16_t version;  // incremented for each new published position, 0 = none yet
+} position;
+
+////////////////////////////////////////////////////////////////////////////////
+char PositionQuality()  // fix mode now, 0 if no position
+{
+  if (!gnss.location.isValid()) return 0;
+  return max(nmea.gnssMode, nmea.gpsMode);  // GN or GP talker, whichever the receiver sends
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PositionUpdate()  // once per second, from GPSParse()
+{
+  char quality = PositionQuality();
+  if (quality == 0 && !position.valid) return;  // nothing yet
+
+#ifndef DEBUG_MANUAL_POSITION
+  double newLat = gnss.location.lat();
+  double newLon = gnss.location.lng();
+  position.alt = gnss.altitude.meters();
+#else
+  double newLat = latitude_manual;
+  double newLon = longitude_manual;
+  position.alt = 0.0;
+#endif
+
+  if (position.valid && quality == position.quality)
+  {
+    // flat earth is good enough for 100 m
+    double dy = (newLat - position.lat) * METERS_PER_DEGREE;
+    double dLon = newLon - position.lon;
+    if (dLon > 180.0) dLon -= 360.0;
+    else if (dLon < -180.0) dLon += 360.0;
+    double dx = dLon * METERS_PER_DEGREE * cos(newLat * RAD);
+    if (dx * dx + dy * dy <= POSITION_MOVE * POSITION_MOVE) return;
+  }
+
+  position.lat = newLat;
+  position.lon = newLon;
+  position.quality = quality;
+  position.valid = true;
+  if (++position.version == 0) position.version = 1;  // 0 is reserved for "none yet"
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PositionGet()  // latitude, lon, alt from snapshot
+{
+  latitude = position.lat;
+  lon = position.lon;
+  alt = position.alt;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool PositionChanged(uint16_t &seen)  // for caches: true once after each new position.version
+{
+  if (seen == position.version) return false;
+  seen = position.version;
+  return true;
+}
+
+/// THE END ///
@@ -0,0 +1,124 @@
+/*
+Phase and frequency of the MCU clock relative to the PPS pulse from the GPS, shown on ScreenPPS     // new 17.10.2026
+
+ppsHandler() stores micros() of each PPS pulse in ppsMicros. PpsPulse(), called by syncCheck() when a new
+pulse has arrived, measures the interval since the previous one, which is 1 000 000 us for a perfect MCU clock:
+
+  ppm:     frequency error of the crystal or resonator of the MCU, + = MCU clock runs fast. Average over
+           the last PPS_FILTER seconds (fewer at start)
+  jitter:  deviation of each interval from this average, i.e. the noise in interrupt latency, micros()
+           resolution (4 us on the Mega) and the PPS pulse itself. Average, and max over PPS_WINDOW seconds
+  lag:     from the PPS pulse to setTime() in syncTimeGPS(), i.e. how much the seconds of now() lag the GPS
+
+An interval which is more than PPS_TOLERANCE from 1 s means a lost pulse, or a long wait before syncCheck()
+ran. The tracking restarts at the next pulse.
+
+nowMicros() gives microseconds into the UTC second of now(), measured from the pulse which started that
+second and scaled with ppm. Without PPS it is counted from when a new second from the GPS was first set, which
+is later than the start of the second by the time it takes to receive the NMEA data. In holdover (clock_holdover.h) it is
+counted from the estimated start of the second.
+A screen which is rendered ahead (see updateDisplay()) is drawn in the second before, so it should not show
+fractions of seconds.
+
+PpsPulse
+PpsSync
+nowMicros
+*/
+
+#define PPS_NOMINAL   1000000L  // us between pulses
+#define PPS_TOLERANCE 20000L    // us, more than 1 % (ceramic resonator of the Mega ~0.5 %)
+#define PPS_FILTER    16        // s, time constant of averages
+#define PPS_WINDOW    60        // s, for max jitter
+
+struct
+{
+  uint32_t lastMicros;    // micros() of pulse which started the present second of now()
+  uint32_t syncMicros;    // micros() at last setTime() in syncTimeGPS()
+  time_t syncTime;        // now() which was set then
+  uint32_t secondMicros;  // micros() at start of present second of now(), for nowMicros()
+  uint32_t lag;           // us from PPS pulse to setTime()
+  float ppm;              // frequency error of MCU clock
+  float jitter;           // us, average deviation of intervals
+  uint16_t jitterMax, jitterMaxLast;  // us, this and last window
+  byte window;            // seconds into this window
+  uint16_t pulses;        // consecutive good intervals, 0 = not tracking
+  uint16_t lost;          // intervals out of tolerance since start
+  bool started;           // lastMicros is set
+} ppsPhase;
+
+////////////////////////////////////////////////////////////////////////////////
+void PpsPulse()  // new pulse, from syncCheck()
+{
+  noInterrupts();
+  uint32_t pulseMicros = ppsMicros;  // 4 bytes, not atomic on AVR
+  interrupts();
+
+  int32_t deviation = (int32_t)(pulseMicros - ppsPhase.lastMicros) - PPS_NOMINAL;  // us too long
+  bool first = !ppsPhase.started;
+  ppsPhase.lastMicros = pulseMicros;
+  ppsPhase.started = true;
+  if (first) return;
+
+  if (deviation > PPS_TOLERANCE || deviation < -PPS_TOLERANCE)
+  {
+    if (ppsPhase.pulses > 0) ppsPhase.lost++;
+    ppsPhase.pulses = 0;  // restart averages
+    return;
+  }
+
+  if (ppsPhase.pulses < 0xFFFF) ppsPhase.pulses++;
+  byte n = min(ppsPhase.pulses, (uint16_t)PPS_FILTER);  // full weight to the first intervals
+  if (ppsPhase.pulses == 1)
+  {
+    ppsPhase.ppm = deviation;  // us per s = ppm
+    ppsPhase.jitter = 0;
+  }
+  else
+  {
+    float residual = deviation - ppsPhase.ppm;
+    ppsPhase.ppm += residual / n;
+    ppsPhase.jitter += (fabs(residual) - ppsPhase.jitter) / n;
+    if (fabs(residual) > ppsPhase.jitterMax) ppsPhase.jitterMax = (fabs(residual) < 65535) ? fabs(residual) : 65535;
+  }
+
+#ifdef FEATURE_SERIAL_PPS
+  Serial.print(F("PPS ")); Serial.print(deviation);
+  Serial.print(F(" us, ")); Serial.print(ppsPhase.ppm, 2);
+  Serial.print(F(" ppm, jitter ")); Serial.print(ppsPhase.jitter, 1);
+  Serial.print(F(" us, lag ")); Serial.println(ppsPhase.lag);
+#endif
+
+  if (++ppsPhase.window < PPS_WINDOW) return;
+  ppsPhase.window = 0;
+  ppsPhase.jitterMaxLast = ppsPhase.jitterMax;
+  ppsPhase.jitterMax = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PpsSync()  // from syncTimeGPS() after setTime()
+{
+  // without PPS, syncTimeGPS() sets the same GPS second on each pass of loop() until the next one has arrived:
+  // only a new second starts a new second for nowMicros()
+  if (!using_PPS && now() == ppsPhase.syncTime) return;
+  ppsPhase.syncMicros = micros();
+  ppsPhase.syncTime = now();
+  ppsPhase.secondMicros = ppsPhase.syncMicros;
+  if (using_PPS && ppsPhase.started)
+  {
+    ppsPhase.lag = ppsPhase.syncMicros - ppsPhase.lastMicros;
+    ppsPhase.secondMicros = ppsPhase.lastMicros;
+  }
+  else if (gnss.time.age() < 1000)  // without PPS: from when the time was received, not when syncCheck() got to it
+    ppsPhase.secondMicros -= gnss.time.age() * 1000UL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint32_t nowMicros()  // us into the second of now(), 0...999999
+{
+  uint32_t since = micros() - ppsPhase.secondMicros;
+  if (ppsPhase.pulses > 0) since -= (int32_t)(since * 1.0e-6 * ppsPhase.ppm);  // MCU us -> GPS us
+  if (since > 999999UL) since = 999999UL;  // next second is late, e.g. pulse lost
+  return since;
+}
+
+/// THE END ///
@@ -0,0 +1,140 @@
+/*
+Replay of recorded NMEA data from PROGMEM instead of the GPS, with FEATURE_NMEA_REPLAY in clock_debug.h     // new 17.10.2026
+
+readGPS() gets its characters from replayLog[] one epoch (= one second of GPS data) at a time.
+Each epoch starts with a $xxRMC sentence, as from u-blox and most other receivers. Before its
+characters, ppsHandler() is called, just as the PPS pulse comes before the NMEA data of that second.
+
+REPLAY_SPEED in clock_debug.h:
+   1   real time, one epoch per second
+   N   N times faster, one epoch per 1000/N ms
+   0   as fast as possible, one epoch per call of readGPS()
+
+Before each new epoch a snapshot goes to the serial port (115200 bps): epoch no, utc, localTime and
+the LCD content. At the end of the log, the no of epochs, bytes and the time it took are written,
+i.e. the throughput of the GPS path (REPLAY_SPEED 0), and the log starts again.
+
+The log below is synthetic: 29.03.2026 00:59:57 - 01:00:04 UTC, GPS + GLONASS + Galileo + BeiDou
+(NMEA 4.10 with signal ID), i.e. start of daylight saving time in Europe, and loss of fix in the last 2 epochs.
+Other scenarios, e.g. a receiver with the 1024 week rollover problem (see adjustTime(619315200) in syncTimeGPS()),
+are run by pasting another capture here, one string per sentence ending with \r\n.
+
+ReplayEpochStart
+ReplaySnapshot
+ReplayEpoch
+*/
+
+#ifndef REPLAY_SPEED
+  #define REPLAY_SPEED 1
+#endif
+
+void ppsHandler();  // forward declaration
+
+const char replayLog[] PROGMEM =
+  "$GNRMC,005957.00,A,5950.29201,N,01025.68001,E,0.02,,290326,,,A,V*2C\r\n"
+  "$GNGGA,005957.00,5950.29201,N,01025.68001,E,1,12,0.78,95.3,M,38.9,M,,*75\r\n"
+  "$GNGSA,A,3,05,13,15,18,20,24,65,66,03,08,13,19,1.32,0.78,1.06,1*05\r\n"
+  "$GPGSV,2,1,07,05,62,215,44,13,48,102,41,15,31,270,38,18,22,065,35,1*6B\r\n"
+  "$GPGSV,2,2,07,20,75,160,46,24,12,310,30,29,08,025,,1*56\r\n"
+  "$GLGSV,1,1,03,65,55,120,40,66,38,200,36,75,18,320,,1*49\r\n"
+  "$GAGSV,1,1,03,03,44,140,42,08,28,250,37,13,60,040,43,7*46\r\n"
+  "$GBGSV,1,1,02,19,35,150,39,22,15,220,,1*70\r\n"
+  "$GNRMC,005958.00,A,5950.29201,N,01025.68001,E,0.02,,290326,,,A,V*23\r\n"
+  "$GNGGA,005958.00,5950.29201,N,01025.68001,E,1,12,0.78,95.3,M,38.9,M,,*7A\r\n"
+  "$GNGSA,A,3,05,13,15,18,20,24,65,66,03,08,13,19,1.32,0.78,1.06,1*05\r\n"
+  "$GNRMC,005959.00,A,5950.29201,N,01025.68001,E,0.02,,290326,,,A,V*22\r\n"
+  "$GNGGA,005959.00,5950.29201,N,01025.68001,E,1,12,0.78,95.3,M,38.9,M,,*7B\r\n"
+  "$GNGSA,A,3,05,13,15,18,20,24,65,66,03,08,13,19,1.32,0.78,1.06,1*05\r\n"
+  "$GPGSV,2,1,07,05,62,215,44,13,48,102,41,15,31,270,38,18,22,065,35,1*6B\r\n"
+  "$GPGSV,2,2,07,20,75,160,46,24,12,310,30,29,08,025,,1*56\r\n"
+  "$GLGSV,1,1,03,65,55,120,40,66,38,200,36,75,18,320,,1*49\r\n"
+  "$GAGSV,1,1,03,03,44,140,42,08,28,250,37,13,60,040,43,7*46\r\n"
+  "$GBGSV,1,1,02,19,35,150,39,22,15,220,,1*70\r\n"
+  "$GNRMC,010000.00,A,5950.29201,N,01025.68001,E,0.02,,290326,,,A,V*23\r\n"
+  "$GNGGA,010000.00,5950.29201,N,01025.68001,E,1,12,0.78,95.3,M,38.9,M,,*7A\r\n"
+  "$GNGSA,A,3,05,13,15,18,20,24,65,66,03,08,13,19,1.32,0.78,1.06,1*05\r\n"
+  "$GNRMC,010001.00,A,5950.29201,N,01025.68001,E,0.02,,290326,,,A,V*22\r\n"
+  "$GNGGA,010001.00,5950.29201,N,01025.68001,E,1,12,0.78,95.3,M,38.9,M,,*7B\r\n"
+  "$GNGSA,A,3,05,13,15,18,20,24,65,66,03,08,13,19,1.32,0.78,1.06,1*05\r\n"
+  "$GPGSV,2,1,07,05,62,215,44,13,48,102,41,15,31,270,38,18,22,065,35,1*6B\r\n"
+  "$GPGSV,2,2,07,20,75,160,46,24,12,310,30,29,08,025,,1*56\r\n"
+  "$GLGSV,1,1,03,65,55,120,40,66,38,200,36,75,18,320,,1*49\r\n"
+  "$GAGSV,1,1,03,03,44,140,42,08,28,250,37,13,60,040,43,7*46\r\n"
+  "$GBGSV,1,1,02,19,35,150,39,22,15,220,,1*70\r\n"
+  "$GNRMC,010002.00,A,5950.29201,N,01025.68001,E,0.02,,290326,,,A,V*21\r\n"
+  "$GNGGA,010002.00,5950.29201,N,01025.68001,E,1,12,0.78,95.3,M,38.9,M,,*78\r\n"
+  "$GNGSA,A,3,05,13,15,18,20,24,65,66,03,08,13,19,1.32,0.78,1.06,1*05\r\n"
+  "$GNRMC,010003.00,V,,,,,,,290326,,,N,V*17\r\n"
+  "$GNGGA,010003.00,,,,,0,00,99.99,,,,,,*7A\r\n"
+  "$GNGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99,1*33\r\n"
+  "$GPGSV,2,1,07,05,62,215,,13,48,102,,15,31,270,,18,22,065,,1*63\r\n"
+  "$GPGSV,2,2,07,20,75,160,,24,12,310,,29,08,025,,1*57\r\n"
+  "$GLGSV,1,1,03,65,55,120,,66,38,200,,75,18,320,,1*48\r\n"
+  "$GAGSV,1,1,03,03,44,140,,08,28,250,,13,60,040,,7*43\r\n"
+  "$GBGSV,1,1,02,19,35,150,,22,15,220,,1*7A\r\n"
+  "$GNRMC,010004.00,V,,,,,,,290326,,,N,V*10\r\n"
+  "$GNGGA,010004.00,,,,,0,00,99.99,,,,,,*7D\r\n"
+  "$GNGSA,A,1,,,,,,,,,,,,,99.99,99.99,99.99,1*33\r\n";
+
+uint16_t replayPos = 0;      // next character of replayLog[]
+uint16_t replayEpochs = 0;   // epochs since start of log
+uint32_t replayLast = 0;     // millis() when last epoch was released
+uint32_t replayStart = 0;    // millis() at start of log
+
+////////////////////////////////////////////////////////////////////////////////
+bool ReplayEpochStart(uint16_t pos)  // sentence at pos is $xxRMC
+{
+  return pgm_read_byte(&replayLog[pos]) == '$' && pgm_read_byte(&replayLog[pos + 3]) == 'R' &&
+         pgm_read_byte(&replayLog[pos + 4]) == 'M' && pgm_read_byte(&replayLog[pos + 5]) == 'C';
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ReplaySnapshot()  // state after last epoch
+{
+  Serial.print(F("replay ")); Serial.print(replayEpochs);
+  Serial.print(F(" utc ")); Serial.print(utc);
+  Serial.print(F(" ")); PrintFixedWidth(Serial, hour(utc), 2, '0');
+  Serial.print(F(":")); PrintFixedWidth(Serial, minute(utc), 2, '0');
+  Serial.print(F(":")); PrintFixedWidth(Serial, second(utc), 2, '0');
+  Serial.print(F(" local ")); PrintFixedWidth(Serial, hour(localTime), 2, '0');
+  Serial.print(F(":")); PrintFixedWidth(Serial, minute(localTime), 2, '0');
+  Serial.print(F(":")); PrintFixedWidth(Serial, second(localTime), 2, '0');
+  Serial.print(F(" ")); Serial.println(tcr != NULL ? tcr->abbrev : "");
+  lcd.printFrame(Serial);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void ReplayEpoch()  // from readGPS(): PPS + characters of next epoch, when it is due
+{
+#if REPLAY_SPEED > 0
+  if (millis() - replayLast < 1000UL / REPLAY_SPEED) return;
+#endif
+  if (replayLast != 0) ReplaySnapshot();  // not before the first epoch
+  replayLast = millis();
+
+  if (replayPos == 0)
+  {
+    replayEpochs = 0;
+    replayStart = millis();
+  }
+
+  ppsHandler();
+  do
+  {
+    char c = pgm_read_byte(&replayLog[replayPos++]);
+    LinkByte(c);
+    NmeaEncode(c);
+    gps.encode(c);
+  } while (pgm_read_byte(&replayLog[replayPos]) != 0 && !ReplayEpochStart(replayPos));
+  replayEpochs++;
+
+  if (pgm_read_byte(&replayLog[replayPos]) == 0)  // end of log
+  {
+    Serial.print(F("replay end: ")); Serial.print(replayEpochs);
+    Serial.print(F(" epochs, ")); Serial.print(replayPos);
+    Serial.print(F(" bytes in ")); Serial.print(millis() - replayStart); Serial.println(F(" ms"));
+    replayPos = 0;
+  }
+}
+
+/// THE END ///
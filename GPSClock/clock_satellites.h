@@ -0,0 +1,174 @@
+/*
+Satellites in view for all constellations, from $GPGSV, $GLGSV, $GAGSV, $GBGSV      // new 17.10.2026
+
+sats[] is a fixed table keyed by (constellation, PRN), filled by NmeaCommit() in clock_nmea.h.
+A GSV cycle (messages 1 ... N of one talker) is assembled message by message. When all messages of a
+cycle have arrived in order, satellites of that constellation which were not in it are removed.
+Satellites of a constellation for which no GSV has arrived for SAT_TIMEOUT seconds are removed by 
+SatExpire(), e.g. when the receiver stops sending it.
+Only the primary signal is used when a receiver sends one GSV cycle per signal (NMEA 4.10 signal ID).
+
+Per constellation, satSystems[] keeps no of satellites in the table, no of tracked ones (SNR > 0) and
+the sum of their SNR. These are updated with each change of the table, so GPSInfo() doesn't have to
+go through the table.
+
+RAM: MAX_SATELLITES x 7 bytes, 48 on the Mega
+
+SatFind
+SatRemove
+SatCycle
+SatUpdate
+SatCycleEnd
+SatExpire
+SatTotals
+SatSNRAvg
+*/
+
+#ifdef ARDUINO_SAMD_VARIANT_COMPLIANCE
+  #define MAX_SATELLITES 64
+#else
+  #define MAX_SATELLITES 48
+#endif
+
+#define SAT_TIMEOUT 10  // s
+
+typedef struct
+{
+  byte system;        // NMEA_GP, NMEA_GL, NMEA_GA, NMEA_GB
+  byte prn;           // 0 = free entry
+  byte elevation;     // degrees
+  uint16_t azimuth;   // degrees
+  byte snr;           // dB, 0 when not tracking
+  byte cycle;         // satSystems[].cycle when last in a GSV
+} sat_type;
+
+sat_type sats[MAX_SATELLITES];
+
+typedef struct
+{
+  byte inTable;       // satellites in sats[]
+  byte tracked;       // satellites with SNR > 0
+  uint16_t snrSum;    // sum of SNR of tracked satellites
+  byte cycle;         // no of present GSV cycle
+  byte nextMessage;   // expected message no of GSV cycle, 0 = wait for message 1
+  byte lastSeen;      // satSeconds when last GSV arrived
+} satSystem_type;
+
+satSystem_type satSystems[NMEA_SYSTEMS];
+
+byte satSeconds = 0;  // seconds, incremented by SatExpire()
+
+////////////////////////////////////////////////////////////////////////////////
+byte SatFind(byte system, byte prn)  // index in sats[], MAX_SATELLITES if not there
+{
+  for (byte i = 0; i < MAX_SATELLITES; i++)
+    if (sats[i].prn == prn && sats[i].system == system) return i;
+  return MAX_SATELLITES;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SatRemove(byte i)
+{
+  satSystem_type *s = &satSystems[sats[i].system];
+  s->inTable--;
+  if (sats[i].snr > 0)
+  {
+    s->tracked--;
+    s->snrSum -= sats[i].snr;
+  }
+  sats[i].prn = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SatCycle(byte system, byte number, byte total)  // before satellites of a GSV message
+{
+  satSystem_type *s = &satSystems[system];
+  if (number == 1)  // new cycle
+  {
+    s->cycle++;
+    s->nextMessage = 2;
+  }
+  else if (number == s->nextMessage) s->nextMessage++;
+  else s->nextMessage = 0;  // message lost: satellites are updated, but cycle is not complete
+  if (number > total) s->nextMessage = 0;
+  s->lastSeen = satSeconds;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SatUpdate(byte system, byte prn, byte elevation, uint16_t azimuth, byte snr)
+{
+  if (prn == 0) return;
+  byte i = SatFind(system, prn);
+  if (i == MAX_SATELLITES)  // new satellite
+  {
+    for (i = 0; i < MAX_SATELLITES && sats[i].prn != 0; i++);  // free entry
+    if (i == MAX_SATELLITES) return;  // table full
+    sats[i].system = system;
+    sats[i].prn = prn;
+    sats[i].snr = 0;
+    satSystems[system].inTable++;
+  }
+
+  satSystem_type *s = &satSystems[system];
+  if (sats[i].snr > 0)  // remove old SNR from statistics
+  {
+    s->tracked--;
+    s->snrSum -= sats[i].snr;
+  }
+  if (snr > 0)
+  {
+    s->tracked++;
+    s->snrSum += snr;
+  }
+  sats[i].elevation = elevation;
+  sats[i].azimuth = azimuth;
+  sats[i].snr = snr;
+  sats[i].cycle = s->cycle;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool SatCycleEnd(byte system, byte number, byte total)  // after satellites of a GSV message, true if cycle is complete
+{
+  satSystem_type *s = &satSystems[system];
+  if (number != total || s->nextMessage != total + 1) return false;
+
+  for (byte i = 0; i < MAX_SATELLITES; i++)  // satellites which were not in this cycle
+    if (sats[i].prn != 0 && sats[i].system == system && sats[i].cycle != s->cycle) SatRemove(i);
+  s->nextMessage = 0;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SatExpire()  // once per second: remove constellations without GSV for SAT_TIMEOUT seconds
+{
+  satSeconds++;
+  for (byte system = 0; system < NMEA_SYSTEMS; system++)
+  {
+    if (satSystems[system].inTable == 0 || (byte)(satSeconds - satSystems[system].lastSeen) <= SAT_TIMEOUT) continue;
+    for (byte i = 0; i < MAX_SATELLITES; i++)
+      if (sats[i].prn != 0 && sats[i].system == system) SatRemove(i);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SatTotals()  // SNRAvg and totalSats for all constellations
+{
+  uint16_t snrSum = 0;
+  totalSats = 0;
+  for (byte system = 0; system < NMEA_SYSTEMS; system++)
+  {
+    totalSats += satSystems[system].tracked;
+    snrSum += satSystems[system].snrSum;
+  }
+  if (totalSats > 0) SNRAvg = float(snrSum) / totalSats;
+  else               SNRAvg = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+int SatSNRAvg(byte system)  // average SNR [dB] of tracked satellites of one constellation
+{
+  if (satSystems[system].tracked == 0) return 0;
+  return (satSystems[system].snrSum + satSystems[system].tracked / 2) / satSystems[system].tracked;
+}
+
+/// THE END ///
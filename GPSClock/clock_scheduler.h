@@ -0,0 +1,264 @@
+/*
+Cooperative task scheduler, replaces the fixed order of calls in loop()    // new 17.10.2026
+
+Each stage of the clock is a task with
+  priority - 0 is highest. Tasks are run in this order
+  period   - minimum time between two runs [ms], 0 = on every pass of loop()
+  deadline - maximum time [ms] a task may wait after it is due. A task which has waited
+             longer is "late", and is run again before any lower priority task is started
+
+A slow screen can therefore only delay GPS input and the rotary encoder by the time of that
+one screen, not by the sum of all stages in loop().
+Long computations (Hebrew calendar, moon rise/set) call TaskYield() now and then in order to
+drain the GPS serial buffer and sample the rotary encoder while they are running.
+
+Run-time statistics per task: no of runs, last/average/max execution time [us],
+max latency after due [ms], and no of late runs.
+Dumped on the serial port every 10 sec with FEATURE_SERIAL_TASKS in clock_debug.h
+Histograms of execution time per task and per screen with FEATURE_PERF, see clock_perf.h
+
+One-shot timers: StartTimer(function, ms) calls function once, ms after the (last) start. 
+Used for time-out of the menu system, and for the time a confirmation screen is shown.   // new 17.10.2026
+
+InitTasks
+RunTask
+RunTasks
+TaskYield
+PrintTaskStats
+StartTimer
+StopTimer
+RunTimers
+*/
+
+void readGPS(void);        // forward declaration
+void GPSParse(void);       // forward declaration
+void syncCheck(void);      // forward declaration
+void updateDisplay(void);  // forward declaration
+void checkEncoder(void);   // forward declaration
+#ifdef FEATURE_BUTTONS
+void readButtons(void);    // forward declaration
+#endif
+#ifdef FEATURE_PERF
+void PerfSerialPoll(void);                         // forward declaration, clock_perf.h
+void PerfAdd(byte stage, uint32_t usedMicros);     // forward declaration, clock_perf.h
+#endif
+
+#define TASK_YIELD 1  // task may also be run from TaskYield(), i.e. in the middle of another task
+
+typedef struct
+{
+  void (*function)(void);
+  char     name[9];
+  byte     priority;    // 0 = highest
+  uint16_t period;      // ms, 0 = every pass of loop()
+  uint16_t deadline;    // ms
+  byte     flags;       // TASK_YIELD
+  uint32_t lastStart;   // millis() when last started
+  // statistics:
+  uint32_t runs;
+  uint16_t lateRuns;
+  uint32_t maxLatency;  // ms
+  uint32_t lastMicros;
+  uint32_t avgMicros;   // running average over ~16 runs
+  uint32_t maxMicros;
+} task_type;
+
+// Deadlines:
+//    readGPS:      64 byte receive buffer of Serial1 is full after 67 ms at 9600 baud, 33 ms at 19200 baud, 5.5 ms at 115200 baud
+// A deadline is not a guarantee: tasks are not pre-empted, so a deadline only makes a late task run before
+// lower priority ones, and counts it as late. Inside a long screen, readGPS only runs where TaskYield() is called:
+// Hebrew calendar, moon rise/set, MoonEclipse() (lunar eclipses, NextEvents) and get_object_position() (planets)
+//    checkEncoder: a fast turn of the rotary encoder gives a state change every few ms
+//    SolarTask:    only has to be done within SOLAR_AHEAD s before UTC midnight
+task_type tasks[] =
+{
+//  function,      name,      prio, period, deadline, flags
+  { readGPS,       "readGPS",    0,    0,    20, TASK_YIELD },
+  { checkEncoder,  "encoder",    1,    0,    10, 0 },
+  { syncCheck,     "sync",       2,    0,    50, 0 },
+  { GPSParse,      "GPSParse",   3,    0,   100, 0 },
+  { updateDisplay, "display",    4,    0,  1000, 0 },
+#ifdef FEATURE_BUTTONS
+  { readButtons,   "buttons",    5,   20,   100, 0 },
+#endif
+#ifdef FEATURE_PERF
+  { PerfSerialPoll, "perf",      6,  100,  1000, 0 },
+#endif
+  { SolarTask,     "solar",      7, 1000, 60000, 0 },  // tomorrow's sun rise/set before UTC midnight, clock_solar.h
+};
+
+const byte noOfTasks = sizeof(tasks) / sizeof(tasks[0]);
+
+#define MAX_TIMERS 4
+
+typedef struct
+{
+  void (*function)(void);  // NULL = timer not in use
+  uint32_t start;          // millis() when started
+  uint32_t interval;       // ms
+} timer_type;
+
+timer_type timers[MAX_TIMERS];
+
+int8_t rotarySteps = 0;  // net steps of encoder sampled in TaskYield(), + clockwise, handled in checkEncoder()
+bool inTaskYield = false;
+
+////////////////////////////////////////////////////////////////////////////////
+void InitTasks()
+{
+  // sort table in order of priority, so order in source doesn't matter
+  for (byte i = 1; i < noOfTasks; i++)
+  {
+    task_type t = tasks[i];
+    int j = i - 1;
+    while (j >= 0 && tasks[j].priority > t.priority)
+    {
+      tasks[j + 1] = tasks[j];
+      j--;
+    }
+    tasks[j + 1] = t;
+  }
+
+  uint32_t timeNow = millis();
+  for (byte i = 0; i < noOfTasks; i++)
+  {
+    tasks[i].lastStart = timeNow;
+    tasks[i].runs = 0;
+    tasks[i].lateRuns = 0;
+    tasks[i].maxLatency = 0;
+    tasks[i].lastMicros = 0;
+    tasks[i].avgMicros = 0;
+    tasks[i].maxMicros = 0;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void RunTask(byte i)
+{
+  uint32_t timeNow = millis();
+  uint32_t latency = timeNow - tasks[i].lastStart;
+  latency = (latency > tasks[i].period) ? latency - tasks[i].period : 0;  // time since task was due
+  if (latency > tasks[i].maxLatency) tasks[i].maxLatency = latency;
+  if (latency > tasks[i].deadline)   tasks[i].lateRuns++;
+
+  tasks[i].lastStart = timeNow;
+  uint32_t startMicros = micros();
+  tasks[i].function();
+  uint32_t usedMicros = micros() - startMicros;
+  // send what the task has written to the LCD, clock_lcd_buffer.h. Not from TaskYield(): that is in the middle of
+  // a screen being drawn, which is only sent by updateDisplay() when it is complete
+  if (!lcd.holding && !inTaskYield) lcd.show();
+
+  tasks[i].runs++;
+  tasks[i].lastMicros = usedMicros;
+  if (usedMicros > tasks[i].maxMicros) tasks[i].maxMicros = usedMicros;
+  if (tasks[i].runs == 1) tasks[i].avgMicros = usedMicros;
+  else                    tasks[i].avgMicros = tasks[i].avgMicros - tasks[i].avgMicros / 16 + usedMicros / 16;
+#ifdef FEATURE_PERF
+  PerfAdd(i, usedMicros);  // stage i = task i, see clock_perf.h
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void PrintTaskStats()
+{
+  Serial.println(F("Task      runs    late maxLat[ms] last[us]  avg[us]  max[us]"));
+  for (byte i = 0; i < noOfTasks; i++)
+  {
+    sprintf(textBuffer, "%-9s", tasks[i].name);
+    Serial.print(textBuffer);
+    Serial.print(F(" ")); Serial.print(tasks[i].runs);
+    Serial.print(F(" ")); Serial.print(tasks[i].lateRuns);
+    Serial.print(F(" ")); Serial.print(tasks[i].maxLatency);
+    Serial.print(F(" ")); Serial.print(tasks[i].lastMicros);
+    Serial.print(F(" ")); Serial.print(tasks[i].avgMicros);
+    Serial.print(F(" ")); Serial.println(tasks[i].maxMicros);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void StartTimer(void (*function)(void), uint32_t interval)  // (re)start one-shot timer for function
+{
+  byte freeTimer = MAX_TIMERS;
+  for (byte i = 0; i < MAX_TIMERS; i++)
+  {
+    if (timers[i].function == function)  // already running: restart
+    {
+      freeTimer = i;
+      break;
+    }
+    if (timers[i].function == NULL && freeTimer == MAX_TIMERS) freeTimer = i;
+  }
+  if (freeTimer == MAX_TIMERS) return;  // no free timer
+
+  timers[freeTimer].function = function;
+  timers[freeTimer].start    = millis();
+  timers[freeTimer].interval = interval;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void StopTimer(void (*function)(void))
+{
+  for (byte i = 0; i < MAX_TIMERS; i++)
+    if (timers[i].function == function) timers[i].function = NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void RunTimers()
+{
+  for (byte i = 0; i < MAX_TIMERS; i++)
+  {
+    if (timers[i].function != NULL && millis() - timers[i].start >= timers[i].interval)
+    {
+      void (*function)(void) = timers[i].function;
+      timers[i].function = NULL;  // one-shot, free before calling as function may start a new timer
+      function();
+      if (!lcd.holding) lcd.show();
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void RunTasks()  // called from loop()
+{
+  RunTimers();
+
+  for (byte i = 0; i < noOfTasks; i++)
+  {
+    if (millis() - tasks[i].lastStart >= tasks[i].period)  // due
+    {
+      RunTask(i);
+
+      // higher priority tasks which have passed their deadline while task i was running get to run before the next one
+      for (byte j = 0; j < i; j++)
+        if (millis() - tasks[j].lastStart >= (uint32_t)tasks[j].period + tasks[j].deadline) RunTask(j);
+    }
+  }
+
+#ifdef FEATURE_SERIAL_TASKS
+  static uint32_t lastPrint = 0;
+  if (millis() - lastPrint >= 10000)
+  {
+    lastPrint = millis();
+    PrintTaskStats();
+  }
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void TaskYield()  // may be called from inside long computations
+{
+  if (inTaskYield) return;  // no recursion
+  inTaskYield = true;
+
+  for (byte i = 0; i < noOfTasks; i++)
+    if ((tasks[i].flags & TASK_YIELD) && (millis() - tasks[i].lastStart >= tasks[i].period)) RunTask(i);
+
+  unsigned char rotaryResult = r.process();  // don't lose steps of rotary encoder, act on them later in checkEncoder()
+  if (rotaryResult == DIR_CW && rotarySteps < 127)        rotarySteps++;  // all steps, not only the last one
+  else if (rotaryResult == DIR_CCW && rotarySteps > -127) rotarySteps--;
+
+  inTaskYield = false;
+}
+
+/// THE END ///
@@ -0,0 +1,128 @@
+/*
+Sun rise, set, twilight and noon of the day, computed once per day     // new 17.10.2026
+
+LcdSolarRiseSet() called calcSunriseSunset(), calcCivilDawnDusk(), ... of SolarCalculator for each line
+of LocalSun(), LocalSunAzEl() and LocalSunMoon(), i.e. up to four times per second, and computed the solar
+elevation at noon and the azimuths at rise and set each time. All of it only changes from day to day.
+
+SolarGet() returns the events of a UTC date, from solar[]: one entry for even and one for odd days, i.e.
+today and tomorrow. An entry is computed again when the position has moved (position.version, see
+clock_position.h) or utcOffset has changed, as its times are kept in local time.
+SolarTask(), a task of low priority in clock_scheduler.h, computes tomorrow in the last SOLAR_AHEAD s
+of the UTC day, so the screen for the first second of the new day has nothing more to compute.
+
+SolarNow() gives the solar azimuth and elevation of now(), once per second.
+
+Horizon for rise/set: Actual (0 deg), Civil (-6 deg), Nautical (-12 deg), Astronomical (-18 deg)
+
+SolarMinutes
+SolarFill
+SolarGet
+SolarNow
+SolarTask
+*/
+
+#define SOLAR_NONE  -32768  // sun doesn't cross this horizon this day, e.g. 'N' in midsummer in Oslo
+#define SOLAR_AHEAD 600     // s before UTC midnight when tomorrow is computed
+
+#define SOLAR_ACTUAL        0
+#define SOLAR_CIVIL         1
+#define SOLAR_NAUTICAL      2
+#define SOLAR_ASTRONOMICAL  3
+
+typedef struct
+{
+  long date;              // elapsedDays() of UTC date, 0 = empty
+  uint16_t version;       // position.version
+  long utcOffset;         // min
+  int16_t transit;        // min, local time of solar noon, as rise and set
+  int16_t rise[4], set[4];  // min, local time, SOLAR_ACTUAL ... SOLAR_ASTRONOMICAL. May be < 0 or > 1440
+  float transitElevation; // deg
+  float riseAzimuth, setAzimuth;  // deg, at actual rise and set
+} solarDay_type;
+
+solarDay_type solar[2];   // even and odd days
+
+struct
+{
+  time_t time;            // of azimuth, elevation
+  double azimuth, elevation;  // deg
+} solarNow;
+
+////////////////////////////////////////////////////////////////////////////////
+int16_t SolarMinutes(double hours)  // UTC hours from SolarCalculator -> minutes, local time
+{
+  if (!(hours >= 0)) return SOLAR_NONE;  // also NAN
+  return int(round(hours * 60 + utcOffset));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SolarFill(solarDay_type *s, long date)
+{
+  double transit, sunrise, sunset;  // UTC hours of events
+  double azimuth, elevation;
+  tmElements_t tm;
+  breakTime(date * SECS_PER_DAY, tm);
+  int yr = tmYearToCalendar(tm.Year);
+
+  s->date = date;
+  s->version = position.version;
+  s->utcOffset = utcOffset;
+
+  calcAstronomicalDawnDusk(yr, tm.Month, tm.Day, position.lat, position.lon, transit, sunrise, sunset);
+  s->rise[SOLAR_ASTRONOMICAL] = SolarMinutes(sunrise);
+  s->set[SOLAR_ASTRONOMICAL]  = SolarMinutes(sunset);
+  calcNauticalDawnDusk(yr, tm.Month, tm.Day, position.lat, position.lon, transit, sunrise, sunset);
+  s->rise[SOLAR_NAUTICAL] = SolarMinutes(sunrise);
+  s->set[SOLAR_NAUTICAL]  = SolarMinutes(sunset);
+  calcCivilDawnDusk(yr, tm.Month, tm.Day, position.lat, position.lon, transit, sunrise, sunset);
+  s->rise[SOLAR_CIVIL] = SolarMinutes(sunrise);
+  s->set[SOLAR_CIVIL]  = SolarMinutes(sunset);
+  calcSunriseSunset(yr, tm.Month, tm.Day, position.lat, position.lon, transit, sunrise, sunset);
+  s->rise[SOLAR_ACTUAL] = SolarMinutes(sunrise);
+  s->set[SOLAR_ACTUAL]  = SolarMinutes(sunset);
+  s->transit = SolarMinutes(transit);
+
+  time_t midnight = date * SECS_PER_DAY;
+  calcHorizontalCoordinates(midnight + (time_t)round(transit * 3600), position.lat, position.lon, azimuth, elevation);
+  s->transitElevation = elevation;
+  s->riseAzimuth = s->setAzimuth = 0;
+  if (sunrise >= 0)
+  {
+    calcHorizontalCoordinates(midnight + (time_t)round(sunrise * 3600), position.lat, position.lon, azimuth, elevation);
+    s->riseAzimuth = azimuth;
+  }
+  if (sunset >= 0)
+  {
+    calcHorizontalCoordinates(midnight + (time_t)round(sunset * 3600), position.lat, position.lon, azimuth, elevation);
+    s->setAzimuth = azimuth;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+solarDay_type *SolarGet(time_t utc)  // events of UTC date of utc
+{
+  long date = elapsedDays(utc);
+  solarDay_type *s = &solar[date & 1];
+  if (s->date != date || s->version != position.version || s->utcOffset != utcOffset) SolarFill(s, date);
+  return s;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SolarNow()  // solarNow.azimuth, elevation for now()
+{
+  if (solarNow.time == now()) return;
+  solarNow.time = now();
+  calcHorizontalCoordinates(solarNow.time, position.lat, position.lon, solarNow.azimuth, solarNow.elevation);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void SolarTask()  // once per second, low priority: tomorrow, before midnight
+{
+  if (timeStatus() == timeNotSet || !position.valid) return;
+  time_t utc = now();
+  if (elapsedSecsToday(utc) < SECS_PER_DAY - SOLAR_AHEAD) return;
+  SolarGet(utc + SOLAR_AHEAD);
+}
+
+/// THE END ///
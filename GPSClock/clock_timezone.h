@@ -7,104 +7,92 @@
 // https://github.com/JChristensen/Timezone
 // https://github.com/JChristensen/Timezone/blob/master/examples/WorldClock/WorldClock.ino
 // TimeChangeRule myRule = {abbrev, week, dayOfWeek, month, hour, offset};
+//
+// 17.10.2026: all zones in one table in flash (PROGMEM), name for setup menu + daylight saving rule + standard time rule.
+// Was TimeChangeRule and Timezone objects in RAM, so more zones now only cost flash. TzLocal() in clock_tzcache.h
+// copies the rules of a zone to RAM when it is used. The same rule twice: no daylight saving.
+// A new zone: add a line at the end, so the numbers of timeZoneNumber in EEPROM and userTimeZones[] still fit.
+// Rules of zones from https://data.iana.org/time-zones/ (tzdata), those with a rule of this kind for 2026
 
-// Central European Time (Frankfurt, Paris)
-   TimeChangeRule CEST = {"CEST", Last, Sun, Mar, 2, 120};     //Central European Summer Time, UTC + 120 min = 2 hrs
-   TimeChangeRule CET = {"CET ", Last, Sun, Oct, 3, 60};       //Central European Time. UTC + 60 min = 1 hr
-   Timezone CE(CEST, CET);
+typedef struct
+{
+  char name[12];        // shown in setup menu, up to 11 characters
+  TimeChangeRule dst;   // start of daylight saving, and its offset
+  TimeChangeRule std;   // start of standard time
+} timeZone_type;
 
+const timeZone_type timeZones[] PROGMEM =
+{
+// name           daylight saving rule                         standard time rule
+// Central European Time (Frankfurt, Paris)
+  {"Central Eur", {"CEST", Last,   Sun, Mar, 2,  120},         {"CET ", Last,   Sun, Oct, 3,   60}},   //  0
 // United Kingdom (London, Belfast) + Ireland
-  TimeChangeRule BST = {"BST", Last, Sun, Mar, 1, 60};        // British Summer Time
-  TimeChangeRule GMT = {"GMT", Last, Sun, Oct, 2, 0};         // Standard Time
-  Timezone UK(BST, GMT);
-
+  {"UK, Ireland", {"BST",  Last,   Sun, Mar, 1,   60},         {"GMT",  Last,   Sun, Oct, 2,    0}},   //  1
 // Canadian Atlantic
-  TimeChangeRule ADT = {"ADT", Second, Sun, Mar, 2, -180};  //UTC - 3 hours
-  TimeChangeRule AST = {"AST", First, Sun, Nov, 2, -240};   //UTC - 4 hours
-  Timezone Atlantic(ADT, AST);
-      
-// Eastern US 
-  TimeChangeRule usEDT = {"EDT", Second, Sun, Mar, 2, -240};  //UTC - 4 hours
-  TimeChangeRule usEST = {"EST", First, Sun, Nov, 2, -300};   //UTC - 5 hours
-  Timezone usEastern(usEDT, usEST);
-
+  {"Atlantic CA", {"ADT",  Second, Sun, Mar, 2, -180},         {"AST",  First,  Sun, Nov, 2, -240}},   //  2
+// Eastern US
+  {"US Eastern",  {"EDT",  Second, Sun, Mar, 2, -240},         {"EST",  First,  Sun, Nov, 2, -300}},   //  3
 // US Central Time Zone (Chicago, Houston)
-  TimeChangeRule usCDT = {"CDT", Second, Sun, Mar, 2, -300};
-  TimeChangeRule usCST = {"CST", First, Sun, Nov, 2, -360};
-  Timezone usCT(usCDT, usCST);
-
+  {"US Central",  {"CDT",  Second, Sun, Mar, 2, -300},         {"CST",  First,  Sun, Nov, 2, -360}},   //  4
 // US Mountain Time Zone (Denver, Salt Lake City)
-  TimeChangeRule usMDT = {"MDT", Second, Sun, Mar, 2, -360};
-  TimeChangeRule usMST = {"MST", First, Sun, Nov, 2, -420};
-  Timezone usMT(usMDT, usMST);
- 
+  {"US Mountain", {"MDT",  Second, Sun, Mar, 2, -360},         {"MST",  First,  Sun, Nov, 2, -420}},   //  5
 // Arizona is US Mountain Time Zone but does not use DST
-  TimeChangeRule AZ = {"AZ", First, Sun, Nov, 2, -420};
-  Timezone usAZ(AZ);
-
-// Pacific US 
-  TimeChangeRule usPDT = {"PDT", Second, Sun, Mar, 2, -420};
-  TimeChangeRule usPST = {"PST", First, Sun, Nov, 2, -480};
-  Timezone usPacific(usPDT, usPST);
-
+  {"Arizona",     {"AZ",   First,  Sun, Nov, 2, -420},         {"AZ",   First,  Sun, Nov, 2, -420}},   //  6
+// Pacific US
+  {"US Pacific",  {"PDT",  Second, Sun, Mar, 2, -420},         {"PST",  First,  Sun, Nov, 2, -480}},   //  7
 // Alaskan US
-  TimeChangeRule usAKDT = {"AKDT", Second, Sun, Mar, 2, -480}; // UTC  - 8
-  TimeChangeRule usAKST = {"AKST", First, Sun, Nov, 2, -540}; 
-  Timezone usAlaska(usAKDT, usAKST);
-
+  {"Alaska",      {"AKDT", Second, Sun, Mar, 2, -480},         {"AKST", First,  Sun, Nov, 2, -540}},   //  8
 // Hawaii US
-  TimeChangeRule usHK = {"HST", Second, Sun, Mar, 2, -600}; // UTC - 10 hrs
-  Timezone usHawaii(usHK);
+  {"Hawaii",      {"HST",  Second, Sun, Mar, 2, -600},         {"HST",  Second, Sun, Mar, 2, -600}},   //  9
 
 /// New day! ////////
-
 // Australia time zones: https://forum.arduino.cc/t/an-array-of-time-zones/406030
 
 // Australia Eastern Time Zone (Sydney, Melbourne): OK
-  TimeChangeRule aEDT = {"AEDT", First, Sun, Oct, 2, 660};    // UTC + 11 hours
-  TimeChangeRule aEST = {"AEST", First, Sun, Apr, 3, 600};    // UTC + 10 hours
-  Timezone ausNSW(aEDT, aEST);
-  
-  Timezone ausQLD(aEST, aEST); // no daylight saving
-
-  //Australia Central Time Zone (Darwin)
-  TimeChangeRule aCDT = {"ACDT", First, Sun, Oct, 2, 630};    //UTC + 10.5 hours
-  TimeChangeRule aCST = {"ACST", First, Sun, Apr, 3, 570};    //UTC +  9.5 hours
-  Timezone ausNT(aCST, aCST); // no daylight saving
-  
-  Timezone ausSA(aCDT, aCST);
- 
+  {"Sydney",      {"AEDT", First,  Sun, Oct, 2,  660},         {"AEST", First,  Sun, Apr, 3,  600}},   // 10
+  {"Brisbane",    {"AEST", First,  Sun, Apr, 3,  600},         {"AEST", First,  Sun, Apr, 3,  600}},   // 11 no daylight saving
+// Australia Central Time Zone (Darwin)
+  {"Darwin",      {"ACST", First,  Sun, Apr, 3,  570},         {"ACST", First,  Sun, Apr, 3,  570}},   // 12 no daylight saving
+  {"Adelaide",    {"ACDT", First,  Sun, Oct, 2,  630},         {"ACST", First,  Sun, Apr, 3,  570}},   // 13
 // Japan standard time, no daylight saving
-  TimeChangeRule JAP = {"JST", Second, Sun, Mar, 2, 540};  // Japan  Time = UTC + 9 hours
-  Timezone Japan(JAP, JAP);
-
-//Australia Western Time Zone (Perth)
-  TimeChangeRule aWST = {"AWST", First, Sun, Apr, 3, 480};    //UTC + 8 hours
-  Timezone ausWA(aWST, aWST); 
- 
+  {"Japan",       {"JST",  Second, Sun, Mar, 2,  540},         {"JST",  Second, Sun, Mar, 2,  540}},   // 14
+// Australia Western Time Zone (Perth)
+  {"Perth",       {"AWST", First,  Sun, Apr, 3,  480},         {"AWST", First,  Sun, Apr, 3,  480}},   // 15
 // China
-  TimeChangeRule CN = {"CHN", Second, Sun, Mar, 2, 480};  // China  Time = UTC + 8 hours
-  Timezone China(CN, CN);
-
-// Indian Standard Time
-  TimeChangeRule inIST = {"IND", Second, Sun, Mar, 2, 330};  // Indian Standard Time = UTC - 5 hours 30 min
-  Timezone India(inIST, inIST);
- 
-// Turkey  Time
-   TimeChangeRule TT = {"TUR", Second, Sun, Mar, 2, 180};  // Turkey  Time = UTC + 3 hours, no DST
-   Timezone Turkey(TT, TT);
-  
-//Eastern European Time (Helsinki +)
-   TimeChangeRule EEST = {"EEST", Last, Sun, Mar, 2, 180};     //Central European Summer Time, UTC + 120 min = 2 hrs
-   TimeChangeRule EET = {"EET ", Last, Sun, Oct, 3, 120};       //Central European Time. UTC + 60 min = 1 hr
-   Timezone EasternEurope(EEST, EET);
- 
-Timezone* timeZones_arr[NUMBER_OF_TIME_ZONES] =
-{
-    &CE, &UK, &Atlantic, &usEastern, &usCT, &usMT, &usAZ, &usPacific, &usAlaska, &usHawaii,
-    &ausNSW, &ausQLD, &ausNT, &ausSA, &Japan, &ausWA, &China, &India, &Turkey, &EasternEurope
+  {"China",       {"CHN",  Second, Sun, Mar, 2,  480},         {"CHN",  Second, Sun, Mar, 2,  480}},   // 16
+// Indian Standard Time = UTC + 5 hours 30 min
+  {"India",       {"IND",  Second, Sun, Mar, 2,  330},         {"IND",  Second, Sun, Mar, 2,  330}},   // 17
+// Turkey Time = UTC + 3 hours, no DST
+  {"Turkey",      {"TUR",  Second, Sun, Mar, 2,  180},         {"TUR",  Second, Sun, Mar, 2,  180}},   // 18
+// Eastern European Time (Helsinki +)
+  {"Eastern Eur", {"EEST", Last,   Sun, Mar, 2,  180},         {"EET ", Last,   Sun, Oct, 3,  120}},   // 19
+
+// new 17.10.2026:
+  {"UTC",         {"UTC",  First,  Sun, Jan, 0,    0},         {"UTC",  First,  Sun, Jan, 0,    0}},   // 20
+  {"Portugal",    {"WEST", Last,   Sun, Mar, 1,   60},         {"WET",  Last,   Sun, Oct, 2,    0}},   // 21 Lisbon, Canary Islands
+  {"Azores",      {"AZOS", Last,   Sun, Mar, 0,    0},         {"AZOT", Last,   Sun, Oct, 1,  -60}},   // 22
+  {"Moscow",      {"MSK",  First,  Sun, Jan, 0,  180},         {"MSK",  First,  Sun, Jan, 0,  180}},   // 23
+  {"S Africa",    {"SAST", First,  Sun, Jan, 0,  120},         {"SAST", First,  Sun, Jan, 0,  120}},   // 24
+  {"W Africa",    {"WAT",  First,  Sun, Jan, 0,   60},         {"WAT",  First,  Sun, Jan, 0,   60}},   // 25 Lagos, Kinshasa
+  {"E Africa",    {"EAT",  First,  Sun, Jan, 0,  180},         {"EAT",  First,  Sun, Jan, 0,  180}},   // 26 Nairobi
+  {"Iran",        {"IRST", First,  Sun, Jan, 0,  210},         {"IRST", First,  Sun, Jan, 0,  210}},   // 27 no DST since 2022
+  {"Gulf",        {"GST",  First,  Sun, Jan, 0,  240},         {"GST",  First,  Sun, Jan, 0,  240}},   // 28 Dubai
+  {"Pakistan",    {"PKT",  First,  Sun, Jan, 0,  300},         {"PKT",  First,  Sun, Jan, 0,  300}},   // 29
+  {"Nepal",       {"NPT",  First,  Sun, Jan, 0,  345},         {"NPT",  First,  Sun, Jan, 0,  345}},   // 30
+  {"Bangladesh",  {"BDT",  First,  Sun, Jan, 0,  360},         {"BDT",  First,  Sun, Jan, 0,  360}},   // 31
+  {"Thailand",    {"ICT",  First,  Sun, Jan, 0,  420},         {"ICT",  First,  Sun, Jan, 0,  420}},   // 32 Bangkok, Hanoi, Jakarta: WIB
+  {"Singapore",   {"SGT",  First,  Sun, Jan, 0,  480},         {"SGT",  First,  Sun, Jan, 0,  480}},   // 33
+  {"Korea",       {"KST",  First,  Sun, Jan, 0,  540},         {"KST",  First,  Sun, Jan, 0,  540}},   // 34
+  {"Guam",        {"ChST", First,  Sun, Jan, 0,  600},         {"ChST", First,  Sun, Jan, 0,  600}},   // 35
+  {"New Zealand", {"NZDT", Last,   Sun, Sep, 2,  780},         {"NZST", First,  Sun, Apr, 3,  720}},   // 36
+  {"Newfoundlnd", {"NDT",  Second, Sun, Mar, 2, -150},         {"NST",  First,  Sun, Nov, 2, -210}},   // 37
+  {"Brazil",      {"BRT",  First,  Sun, Jan, 0, -180},         {"BRT",  First,  Sun, Jan, 0, -180}},   // 38 Sao Paulo, no DST since 2019
+  {"Argentina",   {"ART",  First,  Sun, Jan, 0, -180},         {"ART",  First,  Sun, Jan, 0, -180}},   // 39
+  {"Mexico City", {"CST",  First,  Sun, Jan, 0, -360},         {"CST",  First,  Sun, Jan, 0, -360}},   // 40 no DST since 2022
+  {"Colombia",    {"COT",  First,  Sun, Jan, 0, -300},         {"COT",  First,  Sun, Jan, 0, -300}},   // 41 Bogota, Lima: PET
+  {"Iceland",     {"GMT",  First,  Sun, Jan, 0,    0},         {"GMT",  First,  Sun, Jan, 0,    0}},   // 42
 };
 
-
+#define NUMBER_OF_TIME_ZONES int(sizeof(timeZones) / sizeof(timeZones[0]))  // 17.10.2026: was 20, in GPSClock.ino
 
 /// END ////
@@ -0,0 +1,122 @@
+/*
+Local time for the time zones of clock_timezone.h, with cached daylight saving changes     // new 17.10.2026
+
+Was tz = *timeZones_arr[n]; tz.toLocal(utc, &tcr); in syncTimeGPS() every second, and in Sidereal(), LocalUTC()
+and for each zone in TimeZones(). Each copy of a Timezone object lost its calculated change times, so
+the daylight saving start and end of the year were found with date arithmetic every time.
+
+Here the result for a zone is kept together with the interval of UTC where it holds, i.e. from the last
+to the next change of daylight saving, or new year where the Timezone library finds the changes for the
+next year. Until then, local time is utc + offset. TZ_CACHE_SIZE zones are kept: the one of the clock
+in the first one, and any other zone in the others. The zones of TimeZones() are kept in clock_worldclock.h
+with TzFill().
+The rules are read from timeZones[] in flash when a zone is filled in, and the one which applies is kept
+here, as *rule of TzLocal() points to it.
+
+Same result as Timezone::toLocal(utc, &tcr) of the Timezone library (JChristensen, khoih-prog/Timezone_Generic),
+whose rules are followed here:
+  the change is at local time, daylight saving starts at hour of the dst rule in standard time,
+  and ends at hour of the std rule in daylight saving time.
+  Same time of start and end: no daylight saving
+
+TzRuleTime
+TzFill
+TzLocal
+*/
+
+#define TZ_CACHE_SIZE 2  // 17.10.2026: was 6 before clock_worldclock.h
+
+extern int8_t timeZoneNumber;  // forward declaration, GPSClock.ino
+
+typedef struct
+{
+  int8_t zone;            // no in timeZones[], -1 = empty
+  TimeChangeRule rule;    // daylight saving or standard time rule which applies: offset, abbrev
+  time_t from, until;     // UTC interval where it holds
+} tzCache_type;
+
+tzCache_type tzCache[TZ_CACHE_SIZE] = {{-1}, {-1}};
+byte tzCacheNext = 1;     // slot to be used for a new zone, 0 is for timeZoneNumber
+
+////////////////////////////////////////////////////////////////////////////////
+time_t TzRuleTime(const TimeChangeRule *rule, int yr)  // local time of change in year, as toTime_t() of Timezone library
+{
+  uint8_t m = rule->month;
+  uint8_t w = rule->week;
+  if (w == Last)  // first week of next month, minus 7 days below
+  {
+    if (++m > 12)
+    {
+      m = 1;
+      yr++;
+    }
+    w = First;
+  }
+  tmElements_t tm;
+  tm.Hour = rule->hour;
+  tm.Minute = 0;
+  tm.Second = 0;
+  tm.Day = 1;
+  tm.Month = m;
+  tm.Year = yr - 1970;
+  time_t t = makeTime(tm);
+  t += ((rule->dow - weekday(t) + 7) % 7 + (w - 1) * 7) * SECS_PER_DAY;
+  if (rule->week == Last) t -= 7 * SECS_PER_DAY;
+  return t;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void TzFill(tzCache_type *cache, byte zone, time_t utc)  // offset, rule and interval for utc
+{
+  timeZone_type tz;
+  memcpy_P(&tz, &timeZones[zone], sizeof(tz));
+  TimeChangeRule *dst = &tz.dst;
+  TimeChangeRule *std = &tz.std;
+  int yr = year(utc);
+
+  tmElements_t tm = {0, 0, 0, 0, 1, 1, (uint8_t)(yr - 1970)};  // 1 January
+  time_t change[4];
+  change[0] = makeTime(tm);                                   // Timezone library recalculates each year
+  change[1] = TzRuleTime(dst, yr) - std->offset * SECS_PER_MIN;  // start of daylight saving, UTC
+  change[2] = TzRuleTime(std, yr) - dst->offset * SECS_PER_MIN;  // end
+  tm.Year++;
+  change[3] = makeTime(tm);
+
+  bool isDST;
+  if (change[2] == change[1])     isDST = false;  // no daylight saving
+  else if (change[2] > change[1]) isDST = (utc >= change[1] && utc < change[2]);  // northern hemisphere
+  else                            isDST = !(utc >= change[2] && utc < change[1]); // southern
+
+  cache->zone = zone;
+  cache->rule = isDST ? *dst : *std;
+  cache->from = change[0];
+  cache->until = change[3];
+  for (byte i = 1; i < 3; i++)  // changes of this year around utc
+  {
+    if (change[i] <= utc && change[i] > cache->from)   cache->from = change[i];
+    if (change[i] > utc  && change[i] < cache->until)  cache->until = change[i];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+time_t TzLocal(byte zone, time_t utc, TimeChangeRule **rule)  // as Timezone::toLocal(utc, &tcr)
+{
+  tzCache_type *cache = NULL;
+  if (zone == timeZoneNumber) cache = &tzCache[0];  // not replaced by other zones, tcr points to it
+  else
+    for (byte i = 1; i < TZ_CACHE_SIZE; i++)
+      if (tzCache[i].zone == zone) cache = &tzCache[i];
+
+  if (cache == NULL)  // new zone: replace the oldest one
+  {
+    cache = &tzCache[tzCacheNext];
+    if (++tzCacheNext >= TZ_CACHE_SIZE) tzCacheNext = 1;
+    TzFill(cache, zone, utc);
+  }
+  else if (cache->zone != zone || utc < cache->from || utc >= cache->until) TzFill(cache, zone, utc);  // new zone in menu, or a change has passed
+
+  *rule = &cache->rule;
+  return utc + cache->rule.offset * SECS_PER_MIN;
+}
+
+/// THE END ///
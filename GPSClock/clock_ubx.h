@@ -0,0 +1,316 @@
+/*
+u-blox UBX binary protocol as alternative to NMEA, chosen with "b. GPS protocol" in the secondary setup menu   // new 17.10.2026
+
+With gpsProtocol == PROTOCOL_UBX, readGPS() feeds UbxEncode() instead of NmeaEncode() and gps.encode().
+No text is parsed: fields are taken from fixed offsets of the payload when the checksum is OK.
+The receiver must send these messages, see GpsConfigure() in clock_gpsconfig.h. Therefore UBX can only be chosen
+with GPS_CONFIG_UBLOX in clock_hardware.h, else gpsProtocol is kept at PROTOCOL_NMEA:
+
+  NAV-PVT  0x01 0x07  time, date, fix type, no of satellites in fix, position, height, pDOP
+  NAV-SAT  0x01 0x35  per satellite: constellation, PRN, elevation, azimuth, C/N0 -> sats[], clock_satellites.h
+  TIM-TP   0x0D 0x01  time of next PPS pulse and its quantization error qErr
+
+NAV-PVT is buffered (92 bytes), NAV-SAT is too long for the RAM of the Mega (8 + 12 x satellites), so each
+12 byte block goes to sats[] as it arrives. If the checksum then fails, the cycle is not completed, and satellites
+which have gone are only removed by the next good NAV-SAT.
+
+The rest of the code reads GPS data through gnss, which has the same names as the TinyGPS++ object gps:
+gnss.location.lat(), gnss.time.hour(), gnss.satellites.value() etc. These come from gps with NMEA and from
+ubx.* with UBX. NAV-SAT also fills nmea.inView[], nmea.gsvTotal/gsvNumber, and NAV-PVT fills nmea.gnssMode,
+nmea.gnssStatus, so GPSInfo() works the same way with both protocols. Hdop is pDOP with UBX.
+
+UbxU2
+UbxU4
+UbxSystem
+UbxSatBlock
+UbxCommit
+UbxEncode
+*/
+
+#define UBX_SYNC1 0xB5
+#define UBX_SYNC2 0x62
+
+#define UBX_NAV_PVT 0x0107  // class << 8 | id
+#define UBX_NAV_SAT 0x0135
+#define UBX_TIM_TP  0x0D01
+
+#define UBX_NAV_PVT_LENGTH 92
+#define UBX_TIM_TP_LENGTH  16
+#define UBX_NAV_SAT_HEADER  8  // followed by 12 bytes per satellite
+#define UBX_NAV_SAT_BLOCK  12
+
+struct
+{
+  // NAV-PVT:
+  uint16_t year;
+  byte month, day, hour, minute, second;
+  byte fixType;               // 0 = no fix, 2 = 2D, 3 = 3D, 4 = GNSS + dead reckoning
+  byte numSV;                 // satellites in fix
+  int32_t lat, lon;           // degrees x 1e-7
+  int32_t hMSL;               // height above mean sea level, mm
+  uint16_t pDOP;              // x 0.01
+  bool timeValid;             // as TinyGPS++: true after the first valid one
+  uint32_t timeMillis;        // millis() when time was received, for gnss.time.age()
+  bool dateValid;
+  bool locationValid;
+  bool satellitesValid;
+  bool satellitesUpdated;     // cleared when gnss.satellites.value() is read
+  // TIM-TP:
+  uint32_t pulseTowMs;        // time of week of next PPS pulse, ms
+  uint16_t pulseWeek;
+  int32_t qErr;               // quantization error of next PPS pulse, ps
+  // errors:
+  uint32_t failedChecksum;
+  uint32_t passedChecksum;
+} ubx;
+
+// state of message being received:
+byte ubxState = 0;            // 0: sync 1, 1: sync 2, 2: class, 3: id, 4-5: length, 6: payload, 7-8: checksum
+uint16_t ubxMessage;          // class << 8 | id
+uint16_t ubxLength;
+uint16_t ubxIndex;            // of payload
+byte ubxCkA, ubxCkB;          // Fletcher checksum over class, id, length, payload
+byte ubxCkReceived;
+byte ubxPayload[UBX_NAV_PVT_LENGTH];  // NAV-PVT, TIM-TP, header + present block of NAV-SAT
+byte ubxSatCount[NMEA_SYSTEMS];       // satellites of each constellation in this NAV-SAT
+
+////////////////////////////////////////////////////////////////////////////////
+uint16_t UbxU2(byte offset)  // little endian, also for SAMD which can't read unaligned words
+{
+  return ubxPayload[offset] | (uint16_t)ubxPayload[offset + 1] << 8;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+uint32_t UbxU4(byte offset)
+{
+  return UbxU2(offset) | (uint32_t)UbxU2(offset + 2) << 16;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+byte UbxSystem(byte gnssId)  // NMEA_GP ... from UBX gnssId, NMEA_NONE for SBAS, QZSS, ...
+{
+  switch (gnssId)
+  {
+    case 0: return NMEA_GP;
+    case 2: return NMEA_GA;
+    case 3: return NMEA_GB;
+    case 6: return NMEA_GL;
+  }
+  return NMEA_NONE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void UbxSatBlock()  // one satellite of NAV-SAT, block is at ubxPayload[UBX_NAV_SAT_HEADER]
+{
+  byte *block = &ubxPayload[UBX_NAV_SAT_HEADER];
+  byte system = UbxSystem(block[0]);
+  if (system == NMEA_NONE) return;
+  int8_t elevation = (int8_t)block[3];
+  int16_t azimuth = (int16_t)UbxU2(UBX_NAV_SAT_HEADER + 4);
+  SatUpdate(system, block[1], elevation < 0 ? 0 : elevation, azimuth < 0 ? 0 : azimuth, block[2]);
+  ubxSatCount[system]++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void UbxCommit()  // message with correct checksum: fields -> ubx.*, nmea.*, sats[]
+{
+  switch (ubxMessage)
+  {
+    case UBX_NAV_PVT:
+    {
+      if (ubxLength != UBX_NAV_PVT_LENGTH) break;
+      byte valid = ubxPayload[11];
+      if (valid & 0x01)  // validDate
+      {
+        ubx.year = UbxU2(4);
+        ubx.month = ubxPayload[6];
+        ubx.day = ubxPayload[7];
+        ubx.dateValid = true;
+      }
+      if (valid & 0x02)  // validTime
+      {
+        ubx.hour = ubxPayload[8];
+        ubx.minute = ubxPayload[9];
+        ubx.second = ubxPayload[10];
+        ubx.timeValid = true;
+        ubx.timeMillis = millis();
+      }
+      ubx.fixType = ubxPayload[20];
+      ubx.numSV = ubxPayload[23];
+      ubx.satellitesValid = true;
+      ubx.satellitesUpdated = true;
+      bool fixOK = ubxPayload[21] & 0x01;  // gnssFixOK
+      if (fixOK)
+      {
+        ubx.lon = (int32_t)UbxU4(24);
+        ubx.lat = (int32_t)UbxU4(28);
+        ubx.hMSL = (int32_t)UbxU4(36);
+        ubx.locationValid = true;
+      }
+      ubx.pDOP = UbxU2(76);
+      nmea.gnssMode = (ubx.fixType >= 3) ? '3' : (ubx.fixType == 2) ? '2' : '1';
+      nmea.gnssStatus = fixOK ? 'A' : 'V';
+      break;
+    }
+
+    case UBX_NAV_SAT:
+      for (byte system = 0; system < NMEA_SYSTEMS; system++)
+      {
+        SatCycleEnd(system, 1, 1);  // removes satellites which were not in this message
+        nmea.inView[system] = ubxSatCount[system];
+      }
+      nmea.gsvTotal = 1;
+      nmea.gsvNumber = 1;
+      nmea.gsvCycle = true;
+      break;
+
+    case UBX_TIM_TP:
+      if (ubxLength != UBX_TIM_TP_LENGTH) break;
+      ubx.pulseTowMs = UbxU4(0);
+      ubx.qErr = (int32_t)UbxU4(8);
+      ubx.pulseWeek = UbxU2(12);
+      break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void UbxEncode(byte c)  // one byte from GPS
+{
+  if (ubxState >= 2 && ubxState <= 6)
+  {
+    ubxCkA += c;
+    ubxCkB += ubxCkA;
+  }
+
+  switch (ubxState)
+  {
+    case 0:
+      if (c == UBX_SYNC1) ubxState = 1;
+      break;
+    case 1:
+      ubxState = (c == UBX_SYNC2) ? 2 : (c == UBX_SYNC1) ? 1 : 0;
+      ubxCkA = 0;
+      ubxCkB = 0;
+      break;
+    case 2:
+      ubxMessage = (uint16_t)c << 8;
+      ubxState = 3;
+      break;
+    case 3:
+      ubxMessage |= c;
+      ubxState = 4;
+      break;
+    case 4:
+      ubxLength = c;
+      ubxState = 5;
+      break;
+    case 5:
+      ubxLength |= (uint16_t)c << 8;
+      ubxIndex = 0;
+      ubxState = (ubxLength == 0) ? 7 : 6;
+      break;
+
+    case 6:
+      if (ubxMessage == UBX_NAV_SAT)
+      {
+        if (ubxIndex < UBX_NAV_SAT_HEADER)
+        {
+          ubxPayload[ubxIndex] = c;
+          if (ubxIndex == UBX_NAV_SAT_HEADER - 1)  // new cycle for all constellations
+            for (byte system = 0; system < NMEA_SYSTEMS; system++)
+            {
+              SatCycle(system, 1, 1);
+              ubxSatCount[system] = 0;
+            }
+        }
+        else
+        {
+          byte i = (ubxIndex - UBX_NAV_SAT_HEADER) % UBX_NAV_SAT_BLOCK;
+          ubxPayload[UBX_NAV_SAT_HEADER + i] = c;
+          if (i == UBX_NAV_SAT_BLOCK - 1) UbxSatBlock();
+        }
+      }
+      else if (ubxIndex < sizeof(ubxPayload)) ubxPayload[ubxIndex] = c;
+      if (++ubxIndex == ubxLength) ubxState = 7;
+      break;
+
+    case 7:
+      ubxCkReceived = c;
+      ubxState = 8;
+      break;
+    case 8:
+      if (ubxCkReceived == ubxCkA && c == ubxCkB)
+      {
+        ubx.passedChecksum++;
+        UbxCommit();
+      }
+      else ubx.failedChecksum++;
+      ubxState = 0;
+      break;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// gnss: GPS data from TinyGPS++ (NMEA) or ubx (UBX), same names as in TinyGPS++
+
+struct GnssLocation
+{
+  bool isValid() { return gpsProtocol == PROTOCOL_UBX ? ubx.locationValid : gps.location.isValid(); }
+  double lat()   { return gpsProtocol == PROTOCOL_UBX ? ubx.lat * 1e-7 : gps.location.lat(); }
+  double lng()   { return gpsProtocol == PROTOCOL_UBX ? ubx.lon * 1e-7 : gps.location.lng(); }
+};
+
+struct GnssAltitude
+{
+  double meters() { return gpsProtocol == PROTOCOL_UBX ? ubx.hMSL * 1e-3 : gps.altitude.meters(); }
+};
+
+struct GnssTime
+{
+  bool isValid()  { return gpsProtocol == PROTOCOL_UBX ? ubx.timeValid : gps.time.isValid(); }
+  uint8_t hour()   { return gpsProtocol == PROTOCOL_UBX ? ubx.hour : gps.time.hour(); }
+  uint8_t minute() { return gpsProtocol == PROTOCOL_UBX ? ubx.minute : gps.time.minute(); }
+  uint8_t second() { return gpsProtocol == PROTOCOL_UBX ? ubx.second : gps.time.second(); }
+  uint32_t age()   // ms since time was received
+  {
+    if (gpsProtocol != PROTOCOL_UBX) return gps.time.age();
+    return ubx.timeValid ? millis() - ubx.timeMillis : 0xFFFFFFFF;
+  }
+};
+
+struct GnssDate
+{
+  bool isValid()   { return gpsProtocol == PROTOCOL_UBX ? ubx.dateValid : gps.date.isValid(); }
+  uint16_t year()  { return gpsProtocol == PROTOCOL_UBX ? ubx.year : gps.date.year(); }
+  uint8_t month()  { return gpsProtocol == PROTOCOL_UBX ? ubx.month : gps.date.month(); }
+  uint8_t day()    { return gpsProtocol == PROTOCOL_UBX ? ubx.day : gps.date.day(); }
+};
+
+struct GnssSatellites
+{
+  bool isValid()   { return gpsProtocol == PROTOCOL_UBX ? ubx.satellitesValid : gps.satellites.isValid(); }
+  bool isUpdated() { return gpsProtocol == PROTOCOL_UBX ? ubx.satellitesUpdated : gps.satellites.isUpdated(); }
+  uint32_t value()
+  {
+    if (gpsProtocol != PROTOCOL_UBX) return gps.satellites.value();
+    ubx.satellitesUpdated = false;
+    return ubx.numSV;
+  }
+};
+
+struct GnssHdop
+{
+  double hdop() { return gpsProtocol == PROTOCOL_UBX ? ubx.pDOP * 0.01 : gps.hdop.hdop(); }
+};
+
+struct
+{
+  GnssLocation location;
+  GnssAltitude altitude;
+  GnssTime time;
+  GnssDate date;
+  GnssSatellites satellites;
+  GnssHdop hdop;
+} gnss;
+
+/// THE END ///
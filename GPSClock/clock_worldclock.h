@@ -0,0 +1,122 @@
+/*
+World clock of TimeZones(): up to WORLD_ZONES_MAX zones, WORLD_PER_PAGE at a time     // new 17.10.2026
+
+Was lcdTimeZone() for 4 fixed zones, each a conversion with TzLocal() and hour(), minute() of local time.
+Now each zone on the page keeps its own daylight saving rule and interval from TzFill() of clock_tzcache.h,
+and its local hour and minute, which WorldUpdate() advances by one when the UTC minute changes. The rules
+are only read again when a change of daylight saving (or new year) has passed, when a new page is shown,
+or when the time jumps, e.g. at the first time from the GPS.
+With more than WORLD_PER_PAGE zones, a new page is shown every 10 s (REFRESH_10S).
+
+The list of zones is set in the secondary menu, "i. World clock", and kept in EEPROM:
+  EEPROM_OFFSET1 + 14:        no of zones, 1 ... WORLD_ZONES_MAX
+  EEPROM_OFFSET1 + 15 ... 30: no of each zone in timeZones[] of clock_timezone.h, one byte each
+Cold start: userTimeZones[] of clock_options.h
+
+WorldPages
+WorldSave
+WorldLoad
+WorldFill
+WorldUpdate
+*/
+
+#define WORLD_ZONES_MAX   16
+#define WORLD_PER_PAGE     4   // lines 3 and 4 of TimeZones()
+#define WORLD_EEPROM      (EEPROM_OFFSET1 + 14)
+
+void EEPROMMyupdate(int address, byte val, byte commit);  // forward declaration, clock_helper_routines.h
+
+struct
+{
+  byte count;                           // no of zones in list
+  byte zone[WORLD_ZONES_MAX];           // no in timeZones[]
+  int8_t page;                          // shown, -1 = none yet
+  time_t utcMinute;                     // utc / 60 of hour[], minute[]
+  tzCache_type tz[WORLD_PER_PAGE];      // rule and interval of each zone on page, zone -1 = empty
+  byte hour[WORLD_PER_PAGE], minute[WORLD_PER_PAGE];  // local time
+  int8_t editSlot;                      // menu: position in list
+  int8_t editZone;                      // menu: zone for editSlot, -1 = end of list
+} world = {0, {0}, -1};
+
+////////////////////////////////////////////////////////////////////////////////
+byte WorldPages()
+{
+  if (world.count == 0) return 1;
+  return (world.count + WORLD_PER_PAGE - 1) / WORLD_PER_PAGE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void WorldSave()  // list to EEPROM
+{
+  for (byte i = 0; i < world.count; i++) EEPROMMyupdate(WORLD_EEPROM + 1 + i, world.zone[i], 0);
+  EEPROMMyupdate(WORLD_EEPROM, world.count, 0);
+#ifdef ARDUINO_SAMD_VARIANT_COMPLIANCE
+  EEPROM.commit();  // once for all
+#endif
+  world.page = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void WorldLoad()  // list from EEPROM, or userTimeZones[] if it is not valid
+{
+  world.count = EEPROM.read(WORLD_EEPROM);
+  bool valid = (world.count >= 1 && world.count <= WORLD_ZONES_MAX);
+  for (byte i = 0; valid && i < world.count; i++)
+  {
+    world.zone[i] = EEPROM.read(WORLD_EEPROM + 1 + i);
+    if (world.zone[i] >= NUMBER_OF_TIME_ZONES) valid = false;
+  }
+  if (!valid)  // as in very first startup
+  {
+    world.count = sizeof(userTimeZones) / sizeof(userTimeZones[0]);
+    for (byte i = 0; i < world.count; i++) world.zone[i] = userTimeZones[i];
+    WorldSave();
+  }
+  world.page = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void WorldFill(byte i, time_t utc)  // rule, interval and local time of place i on page
+{
+  byte n = world.page * WORLD_PER_PAGE + i;
+  if (n >= world.count)
+  {
+    world.tz[i].zone = -1;
+    return;
+  }
+  TzFill(&world.tz[i], world.zone[n], utc);
+  time_t local = utc + world.tz[i].rule.offset * SECS_PER_MIN;
+  world.hour[i] = (local / SECS_PER_HOUR) % 24;
+  world.minute[i] = (local / SECS_PER_MIN) % 60;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+bool WorldUpdate(time_t utc)  // each second, from TimeZones(): true if the page has to be drawn
+{
+  int8_t page = (utc / 10) % WorldPages();
+  time_t utcMinute = utc / SECS_PER_MIN;
+  if (page != world.page)  // new page, or new list
+  {
+    world.page = page;
+    world.utcMinute = utcMinute;
+    for (byte i = 0; i < WORLD_PER_PAGE; i++) WorldFill(i, utc);
+    return true;
+  }
+  if (utcMinute == world.utcMinute) return false;
+
+  bool next = (utcMinute == world.utcMinute + 1);
+  world.utcMinute = utcMinute;
+  for (byte i = 0; i < WORLD_PER_PAGE; i++)
+  {
+    if (world.tz[i].zone < 0) continue;
+    if (!next || utc < world.tz[i].from || utc >= world.tz[i].until) WorldFill(i, utc);  // time jump, or change
+    else if (++world.minute[i] >= 60)
+    {
+      world.minute[i] = 0;
+      if (++world.hour[i] >= 24) world.hour[i] = 0;
+    }
+  }
+  return true;
+}
+
+/// THE END ///
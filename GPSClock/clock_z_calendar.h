@@ -15,6 +15,8 @@
 
 class IsoDate;
 
+void TaskYield(void);  // forward declaration, clock_scheduler.h
+
 /*
 char* DayName[7] = {"Sunday", "Monday", "Tuesday", "Wednesday",
                     "Thursday", "Friday", "Saturday"};
@@ -389,14 +391,20 @@ public:
     year = (d + HebrewEpoch) / 366; // Approximation from below.
     // Search forward for year from the approximation.
     while (d >= HebrewDate(7,1,year + 1))
+    {
       year++;
+      TaskYield();  // very slow on Arduino Mega, let GPS input be read meanwhile, 17.10.2026
+    }
     // Search forward for month from either Tishri or Nisan.
     if (d < HebrewDate(1, 1, year))
       month = 7;  //  Start at Tishri
     else
       month = 1;  //  Start at Nisan
     while (d > HebrewDate(month, (LastDayOfHebrewMonth(month,year)), year))
+    {
       month++;
+      TaskYield();
+    }
     // Calculate the day by subtraction.
     day = d - HebrewDate(month, 1, year) + 1;
   }
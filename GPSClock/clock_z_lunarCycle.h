@@ -72,6 +72,8 @@ MOONRISESET;
 static double               VHz[3], RAn[3], Decl[3]; // Dec[] renamed to Decl[]
 static MOONRISESET          MoonRise, MoonSet;
 
+void TaskYield(void);  // forward declaration, clock_scheduler.h
+
 #define PI                  3.1415926535897932384626433832795
 //#define RAD                 (PI/180.0)
 #define SMALL_FLOAT         (1e-12)
@@ -482,6 +484,7 @@ void GetMoonRiseSetTimes
 
     for (k = 0; k < 24; k++)                    // check each hour of this day
     {
+        TaskYield();                            // let GPS input be read meanwhile, 17.10.2026
         ph = (k + 1.0)/24.0;
 
         RAn[2] = moonInterpolate(mp[0].rightascension, 
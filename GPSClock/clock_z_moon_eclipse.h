@@ -44,6 +44,7 @@ void MoonEclipse( int tYear, // input year
   int dateCounter = 0;
   
   for (int K9 = 1; K9 < 28; K9 = K9 + 2) {
+    TaskYield();  // let GPS input be read meanwhile, 17.10.2026
     float J = J0 + 14 * K9;
     float F = F0 + 0.765294 * K9;
     float K = (float)K9 / 2.0;
@@ -75,6 +75,8 @@ float dist_object_to_sun;
 //------------------------------------------------------------------------------------------------------------------
 
 
+void TaskYield(void);  // forward declaration, clock_scheduler.h
+
 //------------------------------------------------------------------------------------------------------------------
 float get_julian_date (float day_, float month_, float year_, float hour_, float minute_, float seconds_) { // UTC
 
@@ -392,6 +394,8 @@ void calc_orbital_coordinates (float semiMajorAxis, float eccentricity, float ec
 // =========================================================================
 void get_object_position (int object_number, float jd, float jd_frac) {
 
+  TaskYield();  // let GPS input be read between planets, 17.10.2026
+
   #ifdef FEATURE_SERIAL_PLANETARY 
     Serial.println(F("----------------------------------------------------"));
     ////Serial.println("Object: " + object_name[object_number]);